@@ -0,0 +1,77 @@
+#include "assets.h"
+#include "job_system.h"
+#include "render_backend.h"
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+namespace {
+
+struct Asset {
+  std::once_flag decoded;
+  std::unique_ptr<Image> image;
+  GLuint texture = 0;
+};
+
+std::string assetDirectory = ".";
+std::mutex assetsMutex;
+std::map<std::string, std::unique_ptr<Asset>> assets;
+
+Asset &FindAsset(const char *name) {
+  std::lock_guard<std::mutex> lock(assetsMutex);
+  std::unique_ptr<Asset> &asset = assets[name];
+  if (!asset)
+    asset.reset(new Asset());
+  return *asset;
+}
+
+} // namespace
+
+void SetAssetDirectory(const std::string &dir) { assetDirectory = dir; }
+
+const Image *DecodeImage(const char *name) {
+  Asset &asset = FindAsset(name);
+  std::call_once(asset.decoded, [&]() {
+    std::string path = assetDirectory + "/" + name;
+    int width, height, nrChannels;
+    stbi_set_flip_vertically_on_load_thread(true);
+    unsigned char *data =
+        stbi_load(path.c_str(), &width, &height, &nrChannels, 4);
+    if (!data) {
+      printf("Failed to load image: %s\n", path.c_str());
+      return;
+    }
+    Image *image = new Image();
+    image->width = width;
+    image->height = height;
+    image->pixels.assign(data, data + width * height * 4);
+    stbi_image_free(data);
+    asset.image.reset(image);
+  });
+  return asset.image.get();
+}
+
+void DecodeImages(const char *const *names, int count) {
+  ParallelFor(count, 1, [names](int begin, int end) {
+    for (int i = begin; i < end; i++)
+      DecodeImage(names[i]);
+  });
+}
+
+GLuint GetTexture(const char *name) {
+  Asset &asset = FindAsset(name);
+  if (asset.texture)
+    return asset.texture;
+
+  const Image *image = DecodeImage(name);
+  if (!image)
+    return 0;
+
+  asset.texture = Renderer()->CreateTexture(*image);
+  return asset.texture;
+}
@@ -0,0 +1,30 @@
+// Image cache shared by all scenes. Decoding is thread-safe so the scene
+// manager can preload the next scene in the background; GL uploads happen
+// lazily on the render thread the first time a texture is requested.
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <GL/gl.h>
+#include <string>
+#include <vector>
+
+struct Image {
+  int width, height;
+  std::vector<unsigned char> pixels; // RGBA, flipped for GL
+};
+
+// Directory holding goldilocks.png and friends (defaults to ".")
+void SetAssetDirectory(const std::string &dir);
+
+// Decodes (once) and returns the image, or nullptr if it failed to load.
+// Safe to call from any thread.
+const Image *DecodeImage(const char *name);
+
+// Decodes several images at once, spread over the job system
+void DecodeImages(const char *const *names, int count);
+
+// Returns the backend texture for an image, decoding and uploading on first
+// use. Must be called on the render thread.
+GLuint GetTexture(const char *name);
+
+#endif
@@ -0,0 +1,315 @@
+#include "background.h"
+
+#include "engine.h"
+#include "palette_mesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Pixels per second squared; weights below zero rise like embers
+const float kGravity = 300.0f;
+const float kUntilOffscreen = 1e9f;
+const float kSeasonFadeSeconds = 0.5f;
+
+// Up to five emitters per season, one per fire in summer. Fields follow
+// ParticleEmitter: spawn box, velocity, life, size, weight, drift, color,
+// shade and rate.
+const int kMaxEmitters = 5;
+const ParticleEmitter kWeather[4][kMaxEmitters] = {
+    // Spring: petals drifting down from above the window
+    {{0, WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_HEIGHT + 10, -20, 20, -40, -25,
+      kUntilOffscreen, kUntilOffscreen, 2, 3.5f, 0, 1.0f, 1.0f, 0.6f, 0.8f,
+      0.15f, 5}},
+    // Summer: embers rising off the five fires
+    {{140, 160, 280, 300, -15, 15, 30, 60, 0.8f, 1.6f, 1, 2, -0.1f, 0.3f,
+      1.0f, 0.5f, 0.1f, 0.3f, 6},
+     {220, 240, 282, 302, -15, 15, 30, 60, 0.8f, 1.6f, 1, 2, -0.1f, 0.3f,
+      1.0f, 0.5f, 0.1f, 0.3f, 6},
+     {603, 623, 280, 300, -15, 15, 30, 60, 0.8f, 1.6f, 1, 2, -0.1f, 0.3f,
+      1.0f, 0.5f, 0.1f, 0.3f, 6},
+     {700, 720, 275, 295, -15, 15, 30, 60, 0.8f, 1.6f, 1, 2, -0.1f, 0.3f,
+      1.0f, 0.5f, 0.1f, 0.3f, 6},
+     {807, 827, 283, 303, -15, 15, 30, 60, 0.8f, 1.6f, 1, 2, -0.1f, 0.3f,
+      1.0f, 0.5f, 0.1f, 0.3f, 6}},
+    // Autumn: leaves falling from the tree crowns until they settle
+    {{560, 850, 190, 300, -10, 10, -30, -15, 4, 6, 3, 5, 0, 1.0f, 0.85f,
+      0.45f, 0.1f, 0.3f, 4}},
+    // Winter: the old 100 flakes at 2 px a tick, now blown by the wind
+    {{0, WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_HEIGHT + 10, 0, 0, -PerTick(2),
+      -PerTick(2), kUntilOffscreen, kUntilOffscreen, 2, 4, 0, 0.5f, 1, 1, 1,
+      0, 100 / (WINDOW_HEIGHT / PerTick(2))}},
+};
+
+float Wind(float time) { return 15.0f * sinf(0.4f * time); }
+
+void UpdateWeather(SkyState &sky, Season season, float dt) {
+  for (int i = 0; i < kMaxEmitters; i++)
+    if (kWeather[season][i].rate > 0)
+      sky.weather.Emit(kWeather[season][i], dt, sky.emitCarry[i]);
+  sky.weather.Update(dt, Wind(sky.time), -kGravity);
+}
+
+} // namespace
+
+void InitSky(SkyState &sky, Season season) {
+  sky.season = sky.fadeFrom = season;
+  sky.fade = 1;
+
+  // Initialize clouds
+  sky.random = NewRandom(RANDOM_SCENERY);
+  for (int i = 0; i < 3; i++)
+    sky.cloudX[i] = sky.random.Below(WINDOW_WIDTH);
+
+  // Run the weather long enough to fill the window
+  sky.time = 0;
+  sky.weather.Clear();
+  sky.weather.Seed(NewRandom(RANDOM_WEATHER));
+  for (float &carry : sky.emitCarry)
+    carry = 0;
+  for (int i = 0; i < 1500; i++) // 24 s: petals take 20 to fall
+    UpdateWeather(sky, season, kTickSeconds);
+}
+
+void UpdateSky(SkyState &sky, Season season, float dt) {
+  // Sun animation
+  sky.sunX += PerTick(sky.sunSpeed) * dt;
+  if (sky.sunX > WINDOW_WIDTH + 50)
+    sky.sunX = -50.0f;
+
+  // Clouds animation
+  for (int i = 0; i < 3; i++) {
+    sky.cloudX[i] += PerTick(0.5f + i * 0.2f) * dt;
+    if (sky.cloudX[i] > WINDOW_WIDTH + 50)
+      sky.cloudX[i] = -50.0f;
+  }
+
+  // Fire flicker
+  for (int i = 0; i < 5; i++)
+    sky.fireOffset[i] = sky.random.Below(10);
+
+  // Season change
+  if (season != sky.season) {
+    sky.fadeFrom = sky.season;
+    sky.season = season;
+    sky.fade = 0;
+  }
+  sky.fade = std::min(sky.fade + dt / kSeasonFadeSeconds, 1.0f);
+
+  // Petals, embers, leaves or snow
+  sky.time += dt;
+  UpdateWeather(sky, season, dt);
+}
+
+// ===== Seasonal Scene Drawing Functions =====
+namespace {
+
+// Sun path y = a (x - h)^2 + k
+const float kSunCurve[3] = {-0.0015f, WINDOW_WIDTH / 2.0f, 520};
+
+struct SeasonColors {
+  float sky[3], ground[3];
+};
+
+const SeasonColors kSeasonColors[] = {
+    {{0.46f, 0.92f, 0.96f}, {0.0f, 0.75f, 0.29f}},       // spring
+    {{0.46f, 0.92f, 0.96f}, {0.0f, 0.75f, 0.29f}},       // summer
+    {{0.45f, 0.65f, 1.0f}, {0.8588f, 0.5882f, 0.1843f}}, // autumn
+    {{0.8f, 0.9f, 1.0f}, {1.0f, 1.0f, 1.0f}},            // winter
+};
+
+// Tree parts that change color with the season
+enum TreeColor {
+  TRUNK,
+  CROWN,       // the middle circle, all that is left in winter
+  CROWN_SIDES, // the two lower circles
+  CROWN_TOP,
+  PETALS,
+  FLOWER_MIDDLE,
+  kTreeColors
+};
+
+// Parts a season does not have are transparent, so fades grow and shed them
+const PaletteColor kTreePalettes[4][kTreeColors] = {
+    // Spring: leaves and flowers
+    {{0.55f, 0.27f, 0.07f, 1},
+     {0.0f, 0.7f, 0.1f, 1},
+     {0.0f, 0.75f, 0.05f, 1},
+     {0.0f, 0.8f, 0.1f, 1},
+     {1, 0.6f, 0.8f, 1},
+     {1, 1, 0.2f, 1}},
+    // Summer: leaves only
+    {{0.55f, 0.27f, 0.07f, 1},
+     {0.0f, 0.7f, 0.1f, 1},
+     {0.0f, 0.75f, 0.05f, 1},
+     {0.0f, 0.8f, 0.1f, 1},
+     {1, 0.6f, 0.8f, 0},
+     {1, 1, 0.2f, 0}},
+    // Autumn: orange crown
+    {{0.55f, 0.27f, 0.07f, 1},
+     {0.929f, 0.608f, 0.125f, 1},
+     {0.929f, 0.608f, 0.125f, 1},
+     {0.95f, 0.65f, 0.2f, 1},
+     {1, 0.6f, 0.8f, 0},
+     {1, 1, 0.2f, 0}},
+    // Winter: one snowy circle
+    {{0.55f, 0.27f, 0.07f, 1},
+     {1, 1, 1, 1},
+     {1, 1, 1, 0},
+     {1, 1, 1, 0},
+     {1, 0.6f, 0.8f, 0},
+     {1, 1, 0.2f, 0}},
+};
+
+void AddFlower(PaletteMesh &mesh, float x, float y) {
+  float petalR = 10;
+  mesh.AddCircle(x, y + petalR, petalR, PETALS);
+  mesh.AddCircle(x, y - petalR, petalR, PETALS);
+  mesh.AddCircle(x + petalR, y, petalR, PETALS);
+  mesh.AddCircle(x - petalR, y, petalR, PETALS);
+  mesh.AddCircle(x, y, petalR * 0.7f, FLOWER_MIDDLE);
+}
+
+// Every season's tree, with its trunk at the origin
+PaletteMesh &TreeMesh() {
+  static PaletteMesh mesh;
+  static bool built = false;
+  if (!built) {
+    mesh.AddRectangle(0, 0, 35, 120, TRUNK);
+    float lx = 18, ly = 110;
+    mesh.AddCircle(lx, ly, 55, CROWN);
+    mesh.AddCircle(lx - 35, ly - 10, 45, CROWN_SIDES);
+    mesh.AddCircle(lx + 35, ly - 10, 45, CROWN_SIDES);
+    mesh.AddCircle(lx, ly + 30, 50, CROWN_TOP);
+    AddFlower(mesh, 5, 170);
+    AddFlower(mesh, 40, 140);
+    AddFlower(mesh, 10, 120);
+    built = true;
+  }
+  return mesh;
+}
+
+// How far the sky has faded into season, and the season it is leaving
+float SeasonFade(Season season, const SkyState &sky, Season &from) {
+  bool fading = sky.season == season && sky.fade < 1;
+  from = fading ? sky.fadeFrom : season;
+  return fading ? sky.fade : 1;
+}
+
+} // namespace
+
+SkyLayer SeasonSkyLayer(Season season, const SkyState &sky) {
+  Season from;
+  float t = SeasonFade(season, sky, from);
+  const SeasonColors &a = kSeasonColors[from], &b = kSeasonColors[season];
+  SeasonColors colors;
+  for (int i = 0; i < 3; i++) {
+    colors.sky[i] = a.sky[i] + (b.sky[i] - a.sky[i]) * t;
+    colors.ground[i] = a.ground[i] + (b.ground[i] - a.ground[i]) * t;
+  }
+  SkyLayer layer = {{colors.sky[0], colors.sky[1], colors.sky[2]},
+                    {colors.ground[0], colors.ground[1], colors.ground[2]},
+                    120,
+                    true,
+                    sky.sunX,
+                    {kSunCurve[0], kSunCurve[1], kSunCurve[2]},
+                    3,
+                    {sky.cloudX[0], sky.cloudX[1], sky.cloudX[2]},
+                    {500, 550, 480}};
+  return layer;
+}
+
+void drawSkyLayer(const SkyLayer &layer) {
+  if (Renderer()->DrawSky(layer))
+    return;
+  drawRectangle(0, layer.horizon, WINDOW_WIDTH, WINDOW_HEIGHT - layer.horizon,
+                layer.sky[0], layer.sky[1], layer.sky[2]);
+  if (layer.sun)
+    drawSun(layer.sunX);
+  drawRectangle(0, 0, WINDOW_WIDTH, layer.horizon, layer.ground[0],
+                layer.ground[1], layer.ground[2]);
+  for (int i = 0; i < layer.cloudCount; i++)
+    drawCloud(layer.cloudX[i], layer.cloudY[i]);
+}
+
+void drawSun(float x) {
+  float a = kSunCurve[0], h = kSunCurve[1], k = kSunCurve[2];
+  float y = a * (x - h) * (x - h) + k;
+
+  drawCircle(x, y, 50, 1.0f, 0.9f, 0.0f);
+
+  for (int i = 0; i < 12; i++) {
+    float ang = i * (2 * M_PI / 12);
+    float x1 = x + cos(ang) * 60;
+    float y1 = y + sin(ang) * 60;
+    float x2 = x + cos(ang + 0.2f) * 75;
+    float y2 = y + sin(ang + 0.2f) * 75;
+    float x3 = x + cos(ang - 0.2f) * 75;
+    float y3 = y + sin(ang - 0.2f) * 75;
+    drawTriangle(x1, y1, x2, y2, x3, y3, 1.0f, 0.8f, 0.0f);
+  }
+}
+
+void drawCloud(float x, float y) {
+  drawCircle(x, y, 30, 1, 1, 1);
+  drawCircle(x + 25, y + 10, 25, 1, 1, 1);
+  drawCircle(x - 25, y + 10, 25, 1, 1, 1);
+  drawCircle(x, y + 15, 28, 1, 1, 1);
+}
+
+void drawFlower(float x, float y) {
+  float petalR = 10;
+  drawCircle(x, y + petalR, petalR, 1, 0.6f, 0.8f);
+  drawCircle(x, y - petalR, petalR, 1, 0.6f, 0.8f);
+  drawCircle(x + petalR, y, petalR, 1, 0.6f, 0.8f);
+  drawCircle(x - petalR, y, petalR, 1, 0.6f, 0.8f);
+  drawCircle(x, y, petalR * 0.7f, 1, 1, 0.2f);
+}
+
+void drawTree(float x, float y, bool flowers, bool autumn, bool winter) {
+  Season season = winter   ? WINTER
+                  : autumn ? AUTUMN
+                  : flowers ? SPRING
+                            : SUMMER;
+  TreeMesh().Draw(x, y, kTreePalettes[season], kTreeColors);
+}
+
+void drawFire(float x, float y, float offset) {
+  drawTriangle(x - 20, y, x + 20, y, x, y + 40 + offset, 1.0f, 0.3f, 0.0f);
+  drawTriangle(x - 15, y + 20, x + 15, y + 20, x, y + 55 + offset, 1.0f, 0.6f,
+               0.0f);
+  drawTriangle(x - 10, y + 35, x + 10, y + 35, x, y + 65 + offset, 1.0f, 0.9f,
+               0.0f);
+}
+
+void DrawSeasonalBackground(Season currentSeason, const SkyState &sky) {
+  // Sky, sun, ground and clouds
+  drawSkyLayer(SeasonSkyLayer(currentSeason, sky));
+
+  // House
+  drawRectangle(120, 120, 150, 100, 0.98f, 0.76f, 0.29f);          // base
+  drawTriangle(100, 220, 290, 220, 195, 300, 0.45f, 0.17f, 0.02f); // roof
+  drawRectangle(180, 120, 40, 70, 0.05f, 0.05f, 0.05f);            // door
+
+  // Trees, recolored rather than rebuilt between seasons
+  Season from;
+  float t = SeasonFade(currentSeason, sky, from);
+  PaletteColor palette[kTreeColors];
+  BlendPalette(kTreePalettes[from], kTreePalettes[currentSeason], t,
+               kTreeColors, palette);
+  for (float x : {600.0f, 700.0f, 800.0f})
+    TreeMesh().Draw(x, 120, palette, kTreeColors);
+
+  // Summer fire on the roof and in the trees
+  if (currentSeason == SUMMER) {
+    drawFire(150, 250, sky.fireOffset[0]);
+    drawFire(230, 252, sky.fireOffset[1]);
+    drawFire(613, 250, sky.fireOffset[2]);
+    drawFire(710, 245, sky.fireOffset[3]);
+    drawFire(817, 253, sky.fireOffset[4]);
+  }
+
+  // Weather in front of everything
+  sky.weather.Draw();
+}
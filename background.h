@@ -0,0 +1,46 @@
+// Outdoor scenery shared by the woods cutscene, the narrative screen and
+// the game: parabolic sun, drifting clouds, house, trees, fire and snow.
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+#include "particles.h"
+#include "random.h"
+#include "render_backend.h"
+
+enum Season { SPRING, SUMMER, AUTUMN, WINTER };
+
+// ===== Seasonal Scene Variables =====
+struct SkyState {
+  float sunX = -50.0f;        // Sun starting X
+  float sunSpeed = 1.0f;      // Sun horizontal speed (px per tick)
+  float cloudX[3] = {0};      // Clouds horizontal positions
+  float fireOffset[5] = {0};  // Fire flicker offsets
+  float time = 0;             // Seconds since InitSky, drives the wind
+  ParticleSystem weather;     // Petals, embers, leaves or snow
+  float emitCarry[5] = {0};   // Fractional spawns per season emitter
+  Random random;              // Cloud placement and fire flicker
+  Season season = SPRING;     // Season of the last update
+  Season fadeFrom = SPRING;   // Season the scenery is fading out of
+  float fade = 1;             // 0 at a season change, 1 once faded in
+};
+
+// Starts the sky with the season's weather already in full swing
+void InitSky(SkyState &sky, Season season = SPRING);
+// A season different from the last update starts a short fade into it
+void UpdateSky(SkyState &sky, Season season, float dt);
+
+// ===== Seasonal Scene Drawing Functions =====
+// Sky, sun, ground and clouds, through the backend's one-pass path when it
+// has one
+void drawSkyLayer(const SkyLayer &layer);
+// The seasonal sky layer with the sun and all three clouds, its colors
+// part way through the sky's fade when season is the one it fades into
+SkyLayer SeasonSkyLayer(Season season, const SkyState &sky);
+void drawSun(float x);
+void drawCloud(float x, float y);
+void drawFlower(float x, float y);
+void drawTree(float x, float y, bool flowers, bool autumn, bool winter);
+void drawFire(float x, float y, float offset);
+void DrawSeasonalBackground(Season currentSeason, const SkyState &sky);
+
+#endif
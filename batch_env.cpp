@@ -0,0 +1,213 @@
+#include "batch_env.h"
+
+#include "game_rules.h"
+#include "job_system.h"
+
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+const int kStepGrain = 4096;
+// Games run through all phases of a step together in blocks this size, so
+// their slots are still in cache from one phase to the next
+const int kBlock = 256;
+
+const float kBasketMaxX = WINDOW_WIDTH - BASKET_WIDTH;
+
+struct SlotArrays {
+  const float *x;
+  float *y, *speed, *kind;
+};
+
+// Moves one slot of games [begin, end), counting what the baskets catch and
+// emptying slots whose item was caught or fell below the window
+void UpdateSlot(const SlotArrays &s, const float *basketX, float *caught,
+                float *lost, int begin, int end, float dt) {
+  const float top = BASKET_Y + BASKET_HEIGHT, bottom = BASKET_Y - ITEM_SIZE;
+  int i = begin;
+#ifdef __SSE2__
+  const __m128 dt4 = _mm_set1_ps(dt), size4 = _mm_set1_ps(ITEM_SIZE);
+  const __m128 width4 = _mm_set1_ps(BASKET_WIDTH);
+  const __m128 top4 = _mm_set1_ps(top), bottom4 = _mm_set1_ps(bottom);
+  const __m128 below4 = _mm_set1_ps(-ITEM_SIZE);
+  const __m128 zero4 = _mm_setzero_ps(), one4 = _mm_set1_ps(1.0f);
+  for (; i + 4 <= end; i += 4) {
+    __m128 x = _mm_loadu_ps(s.x + i), bx = _mm_loadu_ps(basketX + i);
+    __m128 speed = _mm_loadu_ps(s.speed + i);
+    __m128 kind = _mm_loadu_ps(s.kind + i);
+    __m128 y = _mm_sub_ps(_mm_loadu_ps(s.y + i), _mm_mul_ps(speed, dt4));
+
+    // The item's box overlaps the basket's
+    __m128 hit = _mm_and_ps(
+        _mm_and_ps(_mm_cmplt_ps(x, _mm_add_ps(bx, width4)),
+                   _mm_cmpgt_ps(_mm_add_ps(x, size4), bx)),
+        _mm_and_ps(_mm_cmplt_ps(y, top4), _mm_cmpgt_ps(y, bottom4)));
+    __m128 good = _mm_and_ps(hit, _mm_cmpgt_ps(kind, zero4));
+    __m128 bad = _mm_and_ps(hit, _mm_cmplt_ps(kind, zero4));
+    _mm_storeu_ps(caught + i, _mm_add_ps(_mm_loadu_ps(caught + i),
+                                         _mm_and_ps(good, one4)));
+    _mm_storeu_ps(lost + i,
+                  _mm_add_ps(_mm_loadu_ps(lost + i), _mm_and_ps(bad, one4)));
+
+    __m128 keep = _mm_andnot_ps(_mm_or_ps(hit, _mm_cmplt_ps(y, below4)),
+                                _mm_cmpneq_ps(kind, zero4));
+    _mm_storeu_ps(s.y + i, y);
+    _mm_storeu_ps(s.speed + i, _mm_and_ps(keep, speed));
+    _mm_storeu_ps(s.kind + i, _mm_and_ps(keep, kind));
+  }
+#endif
+  for (; i < end; i++) {
+    if (s.kind[i] == 0)
+      continue;
+    float x = s.x[i], y = s.y[i] - s.speed[i] * dt;
+    s.y[i] = y;
+    bool hit = x < basketX[i] + BASKET_WIDTH && x + ITEM_SIZE > basketX[i] &&
+               y < top && y > bottom;
+    if (hit) {
+      if (s.kind[i] > 0)
+        caught[i] += 1;
+      else
+        lost[i] += 1;
+    }
+    if (hit || y < -ITEM_SIZE) {
+      s.speed[i] = 0;
+      s.kind[i] = 0;
+    }
+  }
+}
+
+} // namespace
+
+BatchEnv::BatchEnv(int count, float dt)
+    : count(count), dt(dt), basketX(count), spawnTimer(count), score(count),
+      lives(count), level(count), itemX((size_t)count * kItemSlots),
+      itemY((size_t)count * kItemSlots), itemSpeed((size_t)count * kItemSlots),
+      itemKind((size_t)count * kItemSlots), caught(count), lost(count) {
+  random.reserve(count);
+  Random next = NewRandom(RANDOM_ITEMS);
+  for (int i = 0; i < count; i++) {
+    random.push_back(next);
+    next.Jump();
+  }
+  Reset();
+}
+
+void BatchEnv::Reset() {
+  for (int i = 0; i < count; i++)
+    ResetGame(i);
+}
+
+void BatchEnv::ResetGame(int game) {
+  basketX[game] = WINDOW_WIDTH / 2 - BASKET_WIDTH / 2;
+  spawnTimer[game] = 0;
+  score[game] = 0;
+  lives[game] = STARTING_LIVES;
+  level[game] = 1;
+  for (int s = 0; s < kItemSlots; s++) {
+    itemSpeed[Slot(game, s)] = 0;
+    itemKind[Slot(game, s)] = 0;
+  }
+}
+
+// The same draws in the same order as Game::SpawnItem
+void BatchEnv::SpawnItem(int game) {
+  Random &r = random[game];
+  float x = (float)r.Below(WINDOW_WIDTH - (int)ITEM_SIZE);
+  bool good = r.Below(100) < GOOD_ITEM_CHANCE;
+  r.Next(); // the item's name
+
+  for (int s = 0; s < kItemSlots; s++) {
+    size_t slot = Slot(game, s);
+    if (itemKind[slot] != 0)
+      continue;
+    itemX[slot] = x;
+    itemY[slot] = WINDOW_HEIGHT;
+    itemSpeed[slot] = BASE_ITEM_FALL_SPEED * level[game] + score[game] / 10.0f;
+    itemKind[slot] = good ? 1.0f : -1.0f;
+    return;
+  }
+}
+
+void BatchEnv::ObserveGame(int game, float *out) const {
+  out[0] = (basketX[game] + BASKET_WIDTH / 2) / WINDOW_WIDTH;
+  out[1] = (float)lives[game] / STARTING_LIVES;
+  out[2] = (float)level[game];
+  out[3] = (float)score[game] / LEVEL_UP_SCORE;
+  out += 4;
+  for (int s = 0; s < kItemSlots; s++, out += 4) {
+    size_t slot = Slot(game, s);
+    if (itemKind[slot] == 0) {
+      out[0] = out[1] = out[2] = out[3] = 0;
+      continue;
+    }
+    out[0] = (itemX[slot] + ITEM_SIZE / 2) / WINDOW_WIDTH;
+    out[1] = itemY[slot] / WINDOW_HEIGHT;
+    out[2] = itemSpeed[slot] / WINDOW_HEIGHT;
+    out[3] = itemKind[slot];
+  }
+}
+
+void BatchEnv::Observe(float *observations) const {
+  for (int i = 0; i < count; i++)
+    ObserveGame(i, observations + (size_t)i * kObservationSize);
+}
+
+// Follows Game::Update: move the basket, spawn, then move and collide the
+// items. Catches within one step are counted together, which scores the same
+// as the game's item-by-item loop since a step can level up at most once.
+void BatchEnv::StepBlock(int begin, int end, const int8_t *actions,
+                         float *observations, float *reward, uint8_t *done) {
+  for (int i = begin; i < end; i++) {
+    float direction = (float)((actions[i] > 0) - (actions[i] < 0));
+    basketX[i] = std::min(
+        std::max(basketX[i] + direction * BASKET_SPEED * dt, 0.0f),
+        kBasketMaxX);
+    caught[i] = 0;
+    lost[i] = 0;
+  }
+
+  for (int i = begin; i < end; i++) {
+    spawnTimer[i] += dt;
+    if (spawnTimer[i] >= BASE_ITEM_SPAWN_INTERVAL / level[i]) {
+      SpawnItem(i);
+      spawnTimer[i] = 0;
+    }
+  }
+
+  for (int s = 0; s < kItemSlots; s++) {
+    size_t offset = (size_t)s * count;
+    SlotArrays slot = {itemX.data() + offset, itemY.data() + offset,
+                 itemSpeed.data() + offset, itemKind.data() + offset};
+    UpdateSlot(slot, basketX.data(), caught.data(), lost.data(), begin, end,
+               dt);
+  }
+
+  for (int i = begin; i < end; i++) {
+    int good = (int)caught[i], bad = (int)lost[i];
+    score[i] += good * ITEM_POINTS;
+    if (score[i] >= LEVEL_UP_SCORE) {
+      score[i] -= LEVEL_UP_SCORE;
+      level[i]++;
+    }
+    lives[i] -= bad;
+    reward[i] = (float)(good - bad);
+    done[i] = lives[i] <= 0;
+    if (done[i])
+      ResetGame(i);
+    if (observations)
+      ObserveGame(i, observations + (size_t)i * kObservationSize);
+  }
+}
+
+void BatchEnv::Step(const int8_t *actions, float *observations, float *reward,
+                    uint8_t *done) {
+  ParallelFor(count, kStepGrain, [&](int begin, int end) {
+    for (int block = begin; block < end; block += kBlock)
+      StepBlock(block, std::min(block + kBlock, end), actions, observations,
+                reward, done);
+  });
+}
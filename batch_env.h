@@ -0,0 +1,80 @@
+// Many Season Catcher games stepped in lock-step without a window, for
+// training catcher bots. Each game attribute is its own array and items sit
+// in a fixed number of slots stored slot by slot, so a step moves and
+// collides four games' items per SSE instruction and splits the games across
+// the job system. A game that ends is reset within the same step.
+#ifndef BATCH_ENV_H
+#define BATCH_ENV_H
+
+#include "engine.h"
+#include "random.h"
+
+#include <cstdint>
+#include <vector>
+
+class BatchEnv {
+public:
+  // Item slots per game. At most five items are on screen at once at any
+  // level, so a spawn never finds the slots full.
+  static const int kItemSlots = 8;
+  // Floats per game in an observation: basket center x, lives, level and
+  // score, then per slot the item's center x, y, fall speed and kind (1 good,
+  // -1 bad, 0 empty slot). Positions and speeds are in window widths,
+  // heights and heights per second.
+  static const int kObservationSize = 4 + kItemSlots * 4;
+
+  // Game i draws its items from the RANDOM_ITEMS stream jumped i times, so
+  // game 0 sees the same items as the playable game under the same --seed
+  explicit BatchEnv(int count, float dt = kTickSeconds);
+
+  int Count() const { return count; }
+
+  // Restarts every game
+  void Reset();
+  // Writes Count() * kObservationSize floats
+  void Observe(float *observations) const;
+
+  // Advances every game by one tick. actions[i] moves game i's basket left
+  // (< 0), right (> 0) or not at all. reward[i] is good items caught minus
+  // lives lost; done[i] is 1 when the game ended, in which case it has
+  // already restarted and observations hold its first state. observations
+  // may be null.
+  void Step(const int8_t *actions, float *observations, float *reward,
+            uint8_t *done);
+
+  int Score(int game) const { return score[game]; }
+  int Lives(int game) const { return lives[game]; }
+  int Level(int game) const { return level[game]; }
+  // Left edge of the basket
+  float BasketX(int game) const { return basketX[game]; }
+  // Bottom left corner and fall speed of the item in a slot, in pixels, and
+  // its kind as in observations
+  float ItemX(int game, int slot) const { return itemX[Slot(game, slot)]; }
+  float ItemY(int game, int slot) const { return itemY[Slot(game, slot)]; }
+  float ItemSpeed(int game, int slot) const {
+    return itemSpeed[Slot(game, slot)];
+  }
+  float ItemKind(int game, int slot) const {
+    return itemKind[Slot(game, slot)];
+  }
+
+private:
+  size_t Slot(int game, int slot) const { return (size_t)slot * count + game; }
+  void StepBlock(int begin, int end, const int8_t *actions,
+                 float *observations, float *reward, uint8_t *done);
+  void ResetGame(int game);
+  void SpawnItem(int game);
+  void ObserveGame(int game, float *out) const;
+
+  int count;
+  float dt;
+  std::vector<Random> random;
+  std::vector<float> basketX, spawnTimer;
+  std::vector<int> score, lives, level;
+  // Slot s of game i is at Slot(i, s)
+  std::vector<float> itemX, itemY, itemSpeed, itemKind;
+  // Items caught and lives lost in the current step
+  std::vector<float> caught, lost;
+};
+
+#endif
@@ -0,0 +1,21 @@
+#include "bitmap_font.h"
+
+#include "bitmap_font_data.h"
+
+#include <GL/glut.h>
+
+namespace {
+
+const BitmapFont helvetica12 = {16, 0, 4, helvetica12Glyphs};
+const BitmapFont helvetica18 = {23, 0, 5, helvetica18Glyphs};
+const BitmapFont timesRoman24 = {29, 0, 7, timesRoman24Glyphs};
+
+} // namespace
+
+const BitmapFont &GetBitmapFont(void *glutFont) {
+  if (glutFont == GLUT_BITMAP_HELVETICA_12)
+    return helvetica12;
+  if (glutFont == GLUT_BITMAP_TIMES_ROMAN_24)
+    return timesRoman24;
+  return helvetica18;
+}
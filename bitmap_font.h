@@ -0,0 +1,20 @@
+// Embedded copies of the GLUT bitmap fonts, so text can be measured and
+// drawn by backends that have no GLUT window (see bitmap_font_data.h).
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+struct BitmapFont {
+  int height;
+  float xorig, yorig; // glBitmap origin, i.e. the descent below the baseline
+  const unsigned char *const *glyphs;
+
+  int Advance(unsigned char c) const { return glyphs[c][0]; }
+  // Rows of the glyph, bottom first, (Advance(c) + 7) / 8 bytes each
+  const unsigned char *Rows(unsigned char c) const { return glyphs[c] + 1; }
+};
+
+// Font data for GLUT_BITMAP_HELVETICA_12, GLUT_BITMAP_HELVETICA_18 or
+// GLUT_BITMAP_TIMES_ROMAN_24; any other font falls back to Helvetica 18
+const BitmapFont &GetBitmapFont(void *glutFont);
+
+#endif
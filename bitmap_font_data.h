@@ -0,0 +1,791 @@
+// Glyph bitmaps for the GLUT bitmap fonts the scenes use, taken from
+// freeglut's font data (X Window System fonts, MIT licence) so text can be
+// measured and rasterized without a GLUT window. Each glyph is its advance
+// width followed by Height rows of ceil(width / 8) bytes, bottom row first,
+// most significant bit leftmost -- the layout glBitmap() expects.
+// Generated; do not edit by hand.
+#ifndef BITMAP_FONT_DATA_H
+#define BITMAP_FONT_DATA_H
+
+namespace {
+
+// ===== Helvetica 12 =====
+const unsigned char helvetica12_0[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_1[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_2[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_3[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_4[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_5[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_6[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_7[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_8[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_9[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_10[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_11[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_12[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_13[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_14[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_15[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_16[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_17[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_18[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_19[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_20[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_21[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_22[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_23[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_24[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_25[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_26[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_27[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_28[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_29[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_30[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_31[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_32[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_33[] = {3,0,0,0,0,64,0,64,64,64,64,64,64,64,0,0,0};
+const unsigned char helvetica12_34[] = {5,0,0,0,0,0,0,0,0,0,0,80,80,80,0,0,0};
+const unsigned char helvetica12_35[] = {7,0,0,0,0,80,80,80,252,40,252,40,40,0,0,0,0};
+const unsigned char helvetica12_36[] = {7,0,0,0,16,56,84,84,20,56,80,84,56,16,0,0,0};
+const unsigned char helvetica12_37[] = {11,0,0,0,0,0,0,0,0,17,128,10,64,10,64,9,128,4,0,52,0,74,0,74,0,49,0,0,0,0,0,0,0};
+const unsigned char helvetica12_38[] = {9,0,0,0,0,0,0,0,0,57,0,70,0,66,0,69,0,40,0,24,0,36,0,36,0,24,0,0,0,0,0,0,0};
+const unsigned char helvetica12_39[] = {3,0,0,0,0,0,0,0,0,0,0,64,32,96,0,0,0};
+const unsigned char helvetica12_40[] = {4,0,16,32,32,64,64,64,64,64,64,32,32,16,0,0,0};
+const unsigned char helvetica12_41[] = {4,0,128,64,64,32,32,32,32,32,32,64,64,128,0,0,0};
+const unsigned char helvetica12_42[] = {5,0,0,0,0,0,0,0,0,0,0,80,32,80,0,0,0};
+const unsigned char helvetica12_43[] = {7,0,0,0,0,0,16,16,124,16,16,0,0,0,0,0,0};
+const unsigned char helvetica12_44[] = {4,0,0,64,32,32,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_45[] = {8,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_46[] = {3,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_47[] = {4,0,0,0,0,128,128,64,64,64,32,32,16,16,0,0,0};
+const unsigned char helvetica12_48[] = {7,0,0,0,0,56,68,68,68,68,68,68,68,56,0,0,0};
+const unsigned char helvetica12_49[] = {7,0,0,0,0,16,16,16,16,16,16,16,112,16,0,0,0};
+const unsigned char helvetica12_50[] = {7,0,0,0,0,124,64,64,32,16,8,4,68,56,0,0,0};
+const unsigned char helvetica12_51[] = {7,0,0,0,0,56,68,68,4,4,24,4,68,56,0,0,0};
+const unsigned char helvetica12_52[] = {7,0,0,0,0,8,8,252,136,72,40,40,24,8,0,0,0};
+const unsigned char helvetica12_53[] = {7,0,0,0,0,56,68,68,4,4,120,64,64,124,0,0,0};
+const unsigned char helvetica12_54[] = {7,0,0,0,0,56,68,68,68,100,88,64,68,56,0,0,0};
+const unsigned char helvetica12_55[] = {7,0,0,0,0,32,32,16,16,16,8,8,4,124,0,0,0};
+const unsigned char helvetica12_56[] = {7,0,0,0,0,56,68,68,68,68,56,68,68,56,0,0,0};
+const unsigned char helvetica12_57[] = {7,0,0,0,0,56,68,4,4,60,68,68,68,56,0,0,0};
+const unsigned char helvetica12_58[] = {3,0,0,0,0,64,0,0,0,0,64,0,0,0,0,0,0};
+const unsigned char helvetica12_59[] = {3,0,0,128,64,64,0,0,0,0,64,0,0,0,0,0,0};
+const unsigned char helvetica12_60[] = {7,0,0,0,0,0,12,48,192,48,12,0,0,0,0,0,0};
+const unsigned char helvetica12_61[] = {7,0,0,0,0,0,0,124,0,124,0,0,0,0,0,0,0};
+const unsigned char helvetica12_62[] = {7,0,0,0,0,0,96,24,6,24,96,0,0,0,0,0,0};
+const unsigned char helvetica12_63[] = {7,0,0,0,0,16,0,16,16,8,8,68,68,56,0,0,0};
+const unsigned char helvetica12_64[] = {12,0,0,0,0,0,0,31,0,32,0,77,128,83,64,81,32,81,32,73,32,38,160,48,64,15,128,0,0,0,0,0,0};
+const unsigned char helvetica12_65[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,20,0,8,0,0,0,0,0,0,0};
+const unsigned char helvetica12_66[] = {8,0,0,0,0,124,66,66,66,124,66,66,66,124,0,0,0};
+const unsigned char helvetica12_67[] = {9,0,0,0,0,0,0,0,0,30,0,33,0,64,0,64,0,64,0,64,0,64,0,33,0,30,0,0,0,0,0,0,0};
+const unsigned char helvetica12_68[] = {9,0,0,0,0,0,0,0,0,124,0,66,0,65,0,65,0,65,0,65,0,65,0,66,0,124,0,0,0,0,0,0,0};
+const unsigned char helvetica12_69[] = {8,0,0,0,0,126,64,64,64,126,64,64,64,126,0,0,0};
+const unsigned char helvetica12_70[] = {8,0,0,0,0,64,64,64,64,124,64,64,64,126,0,0,0};
+const unsigned char helvetica12_71[] = {9,0,0,0,0,0,0,0,0,29,0,35,0,65,0,65,0,71,0,64,0,64,0,33,0,30,0,0,0,0,0,0,0};
+const unsigned char helvetica12_72[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,65,0,127,0,65,0,65,0,65,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_73[] = {3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,0,0};
+const unsigned char helvetica12_74[] = {7,0,0,0,0,56,68,68,4,4,4,4,4,4,0,0,0};
+const unsigned char helvetica12_75[] = {8,0,0,0,0,65,66,68,72,112,80,72,68,66,0,0,0};
+const unsigned char helvetica12_76[] = {7,0,0,0,0,124,64,64,64,64,64,64,64,64,0,0,0};
+const unsigned char helvetica12_77[] = {11,0,0,0,0,0,0,0,0,68,64,68,64,74,64,74,64,81,64,81,64,96,192,96,192,64,64,0,0,0,0,0,0};
+const unsigned char helvetica12_78[] = {9,0,0,0,0,0,0,0,0,65,0,67,0,69,0,69,0,73,0,81,0,81,0,97,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_79[] = {10,0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,30,0,0,0,0,0,0,0};
+const unsigned char helvetica12_80[] = {8,0,0,0,0,64,64,64,64,124,66,66,66,124,0,0,0};
+const unsigned char helvetica12_81[] = {10,0,0,0,0,0,0,0,0,30,128,33,0,66,128,68,128,64,128,64,128,64,128,33,0,30,0,0,0,0,0,0,0};
+const unsigned char helvetica12_82[] = {8,0,0,0,0,66,66,66,68,124,66,66,66,124,0,0,0};
+const unsigned char helvetica12_83[] = {8,0,0,0,0,60,66,66,2,12,48,64,66,60,0,0,0};
+const unsigned char helvetica12_84[] = {7,0,0,0,0,16,16,16,16,16,16,16,16,254,0,0,0};
+const unsigned char helvetica12_85[] = {8,0,0,0,0,60,66,66,66,66,66,66,66,66,0,0,0};
+const unsigned char helvetica12_86[] = {9,0,0,0,0,0,0,0,0,8,0,8,0,20,0,20,0,34,0,34,0,34,0,65,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_87[] = {11,0,0,0,0,0,0,0,0,17,0,17,0,17,0,42,128,42,128,36,128,68,64,68,64,68,64,0,0,0,0,0,0};
+const unsigned char helvetica12_88[] = {9,0,0,0,0,0,0,0,0,65,0,34,0,34,0,20,0,8,0,20,0,34,0,34,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_89[] = {9,0,0,0,0,0,0,0,0,8,0,8,0,8,0,8,0,20,0,34,0,34,0,65,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_90[] = {9,0,0,0,0,0,0,0,0,127,0,64,0,32,0,16,0,8,0,4,0,2,0,1,0,127,0,0,0,0,0,0,0};
+const unsigned char helvetica12_91[] = {3,0,96,64,64,64,64,64,64,64,64,64,64,96,0,0,0};
+const unsigned char helvetica12_92[] = {4,0,0,0,0,16,16,32,32,32,64,64,128,128,0,0,0};
+const unsigned char helvetica12_93[] = {3,0,192,64,64,64,64,64,64,64,64,64,64,192,0,0,0};
+const unsigned char helvetica12_94[] = {6,0,0,0,0,0,0,0,0,0,136,80,32,0,0,0,0};
+const unsigned char helvetica12_95[] = {7,0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_96[] = {3,0,0,0,0,0,0,0,0,0,0,192,128,64,0,0,0};
+const unsigned char helvetica12_97[] = {7,0,0,0,0,58,68,68,60,4,68,56,0,0,0,0,0};
+const unsigned char helvetica12_98[] = {7,0,0,0,0,88,100,68,68,68,100,88,64,64,0,0,0};
+const unsigned char helvetica12_99[] = {7,0,0,0,0,56,68,64,64,64,68,56,0,0,0,0,0};
+const unsigned char helvetica12_100[] = {7,0,0,0,0,52,76,68,68,68,76,52,4,4,0,0,0};
+const unsigned char helvetica12_101[] = {7,0,0,0,0,56,68,64,124,68,68,56,0,0,0,0,0};
+const unsigned char helvetica12_102[] = {3,0,0,0,0,64,64,64,64,64,64,224,64,48,0,0,0};
+const unsigned char helvetica12_103[] = {7,0,56,68,4,52,76,68,68,68,76,52,0,0,0,0,0};
+const unsigned char helvetica12_104[] = {7,0,0,0,0,68,68,68,68,68,100,88,64,64,0,0,0};
+const unsigned char helvetica12_105[] = {3,0,0,0,0,64,64,64,64,64,64,64,0,64,0,0,0};
+const unsigned char helvetica12_106[] = {3,0,128,64,64,64,64,64,64,64,64,64,0,64,0,0,0};
+const unsigned char helvetica12_107[] = {6,0,0,0,0,68,72,80,96,96,80,72,64,64,0,0,0};
+const unsigned char helvetica12_108[] = {3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,0,0};
+const unsigned char helvetica12_109[] = {9,0,0,0,0,0,0,0,0,73,0,73,0,73,0,73,0,73,0,109,0,82,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_110[] = {7,0,0,0,0,68,68,68,68,68,100,88,0,0,0,0,0};
+const unsigned char helvetica12_111[] = {7,0,0,0,0,56,68,68,68,68,68,56,0,0,0,0,0};
+const unsigned char helvetica12_112[] = {7,0,64,64,64,88,100,68,68,68,100,88,0,0,0,0,0};
+const unsigned char helvetica12_113[] = {7,0,4,4,4,52,76,68,68,68,76,52,0,0,0,0,0};
+const unsigned char helvetica12_114[] = {4,0,0,0,0,64,64,64,64,64,96,80,0,0,0,0,0};
+const unsigned char helvetica12_115[] = {6,0,0,0,0,48,72,8,48,64,72,48,0,0,0,0,0};
+const unsigned char helvetica12_116[] = {3,0,0,0,0,96,64,64,64,64,64,224,64,64,0,0,0};
+const unsigned char helvetica12_117[] = {7,0,0,0,0,52,76,68,68,68,68,68,0,0,0,0,0};
+const unsigned char helvetica12_118[] = {7,0,0,0,0,16,16,40,40,68,68,68,0,0,0,0,0};
+const unsigned char helvetica12_119[] = {9,0,0,0,0,0,0,0,0,34,0,34,0,85,0,73,0,73,0,136,128,136,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_120[] = {6,0,0,0,0,132,132,72,48,48,72,132,0,0,0,0,0};
+const unsigned char helvetica12_121[] = {7,0,64,32,16,16,40,40,72,68,68,68,0,0,0,0,0};
+const unsigned char helvetica12_122[] = {6,0,0,0,0,120,64,32,32,16,8,120,0,0,0,0,0};
+const unsigned char helvetica12_123[] = {4,0,48,64,64,64,64,64,128,64,64,64,64,48,0,0,0};
+const unsigned char helvetica12_124[] = {3,0,64,64,64,64,64,64,64,64,64,64,64,64,0,0,0};
+const unsigned char helvetica12_125[] = {4,0,192,32,32,32,32,32,16,32,32,32,32,192,0,0,0};
+const unsigned char helvetica12_126[] = {7,0,0,0,0,0,0,0,152,100,0,0,0,0,0,0,0};
+const unsigned char helvetica12_127[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_128[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_129[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_130[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_131[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_132[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_133[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_134[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_135[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_136[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_137[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_138[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_139[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_140[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_141[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_142[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_143[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_144[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_145[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_146[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_147[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_148[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_149[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_150[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_151[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_152[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_153[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_154[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_155[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_156[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_157[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_158[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_159[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_160[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_161[] = {3,0,64,64,64,64,64,64,64,64,0,64,0,0,0,0,0};
+const unsigned char helvetica12_162[] = {7,0,0,0,32,56,100,80,80,80,84,56,8,0,0,0,0};
+const unsigned char helvetica12_163[] = {7,0,0,0,0,88,36,16,16,120,32,32,36,24,0,0,0};
+const unsigned char helvetica12_164[] = {7,0,0,0,0,0,132,120,72,72,120,132,0,0,0,0,0};
+const unsigned char helvetica12_165[] = {7,0,0,0,0,16,16,124,16,124,16,40,68,68,0,0,0};
+const unsigned char helvetica12_166[] = {3,0,0,64,64,64,64,0,0,0,64,64,64,64,0,0,0};
+const unsigned char helvetica12_167[] = {6,0,112,136,8,48,72,136,136,144,96,128,136,112,0,0,0};
+const unsigned char helvetica12_168[] = {3,0,0,0,0,0,0,0,0,0,0,0,0,160,0,0,0};
+const unsigned char helvetica12_169[] = {11,0,0,0,0,0,0,0,0,31,0,32,128,78,64,81,64,80,64,81,64,78,64,32,128,31,0,0,0,0,0,0,0};
+const unsigned char helvetica12_170[] = {5,0,0,0,0,0,0,0,0,112,0,80,16,112,0,0,0};
+const unsigned char helvetica12_171[] = {7,0,0,0,0,0,20,40,80,40,20,0,0,0,0,0,0};
+const unsigned char helvetica12_172[] = {8,0,0,0,0,0,0,2,2,2,126,0,0,0,0,0,0};
+const unsigned char helvetica12_173[] = {5,0,0,0,0,0,0,0,240,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_174[] = {11,0,0,0,0,0,0,0,0,31,0,32,128,74,64,74,64,76,64,74,64,78,64,32,128,31,0,0,0,0,0,0,0};
+const unsigned char helvetica12_175[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,240,0,0,0};
+const unsigned char helvetica12_176[] = {5,0,0,0,0,0,0,0,0,96,144,144,96,0,0,0,0};
+const unsigned char helvetica12_177[] = {7,0,0,0,0,124,0,16,16,124,16,16,0,0,0,0,0};
+const unsigned char helvetica12_178[] = {4,0,0,0,0,0,0,0,240,64,32,144,96,0,0,0,0};
+const unsigned char helvetica12_179[] = {4,0,0,0,0,0,0,0,192,32,64,32,224,0,0,0,0};
+const unsigned char helvetica12_180[] = {2,0,0,0,0,0,0,0,0,0,0,0,0,128,64,0,0};
+const unsigned char helvetica12_181[] = {7,0,64,64,64,116,76,68,68,68,68,68,0,0,0,0,0};
+const unsigned char helvetica12_182[] = {7,0,40,40,40,40,40,40,104,232,232,232,104,60,0,0,0};
+const unsigned char helvetica12_183[] = {3,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_184[] = {3,0,192,32,32,64,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_185[] = {4,0,0,0,0,0,0,0,32,32,32,96,32,0,0,0,0};
+const unsigned char helvetica12_186[] = {5,0,0,0,0,0,0,0,0,112,0,112,80,112,0,0,0};
+const unsigned char helvetica12_187[] = {7,0,0,0,0,0,80,40,20,40,80,0,0,0,0,0,0};
+const unsigned char helvetica12_188[] = {10,0,0,0,0,0,0,0,0,65,0,39,128,21,0,19,0,73,0,68,0,68,0,194,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_189[] = {10,0,0,0,0,0,0,0,0,71,128,34,0,17,0,20,128,75,0,72,0,68,0,194,0,65,0,0,0,0,0,0,0};
+const unsigned char helvetica12_190[] = {10,0,0,0,0,0,0,0,0,33,0,23,128,21,0,11,0,201,0,36,0,68,0,34,0,225,0,0,0,0,0,0,0};
+const unsigned char helvetica12_191[] = {7,0,56,68,68,32,32,16,16,0,16,0,0,0,0,0,0};
+const unsigned char helvetica12_192[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,8,0,8,0,0,0,8,0,16,0};
+const unsigned char helvetica12_193[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,8,0,8,0,0,0,8,0,4,0};
+const unsigned char helvetica12_194[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,8,0,8,0,0,0,20,0,8,0};
+const unsigned char helvetica12_195[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,8,0,8,0,0,0,20,0,10,0};
+const unsigned char helvetica12_196[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,8,0,8,0,0,0,20,0,0,0};
+const unsigned char helvetica12_197[] = {9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,62,0,34,0,34,0,20,0,8,0,8,0,8,0,20,0,8,0};
+const unsigned char helvetica12_198[] = {11,0,0,0,0,0,0,0,0,71,192,68,0,68,0,60,0,39,192,36,0,20,0,20,0,15,192,0,0,0,0,0,0};
+const unsigned char helvetica12_199[] = {9,0,0,24,0,4,0,4,0,30,0,33,0,64,0,64,0,64,0,64,0,64,0,33,0,30,0,0,0,0,0,0,0};
+const unsigned char helvetica12_200[] = {8,0,0,0,0,126,64,64,64,126,64,64,64,126,0,8,16};
+const unsigned char helvetica12_201[] = {8,0,0,0,0,126,64,64,64,126,64,64,64,126,0,8,4};
+const unsigned char helvetica12_202[] = {8,0,0,0,0,126,64,64,64,126,64,64,64,126,0,20,8};
+const unsigned char helvetica12_203[] = {8,0,0,0,0,126,64,64,64,126,64,64,64,126,0,20,0};
+const unsigned char helvetica12_204[] = {3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,64,128};
+const unsigned char helvetica12_205[] = {3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,64,32};
+const unsigned char helvetica12_206[] = {3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,160,64};
+const unsigned char helvetica12_207[] = {3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,160,0};
+const unsigned char helvetica12_208[] = {9,0,0,0,0,0,0,0,0,124,0,66,0,65,0,65,0,241,0,65,0,65,0,66,0,124,0,0,0,0,0,0,0};
+const unsigned char helvetica12_209[] = {9,0,0,0,0,0,0,0,0,65,0,67,0,69,0,69,0,73,0,81,0,81,0,97,0,65,0,0,0,20,0,10,0};
+const unsigned char helvetica12_210[] = {10,0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,30,0,0,0,4,0,8,0};
+const unsigned char helvetica12_211[] = {10,0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,30,0,0,0,4,0,2,0};
+const unsigned char helvetica12_212[] = {10,0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,30,0,0,0,10,0,4,0};
+const unsigned char helvetica12_213[] = {10,0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,30,0,0,0,20,0,10,0};
+const unsigned char helvetica12_214[] = {10,0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,30,0,0,0,18,0,0,0};
+const unsigned char helvetica12_215[] = {7,0,0,0,0,0,68,40,16,40,68,0,0,0,0,0,0};
+const unsigned char helvetica12_216[] = {10,0,0,0,0,0,0,128,0,94,0,33,0,80,128,72,128,68,128,68,128,66,128,33,0,30,128,0,64,0,0,0,0};
+const unsigned char helvetica12_217[] = {8,0,0,0,0,60,66,66,66,66,66,66,66,66,0,8,16};
+const unsigned char helvetica12_218[] = {8,0,0,0,0,60,66,66,66,66,66,66,66,66,0,8,4};
+const unsigned char helvetica12_219[] = {8,0,0,0,0,60,66,66,66,66,66,66,66,66,0,20,8};
+const unsigned char helvetica12_220[] = {8,0,0,0,0,60,66,66,66,66,66,66,66,66,0,36,0};
+const unsigned char helvetica12_221[] = {9,0,0,0,0,0,0,0,0,8,0,8,0,8,0,8,0,20,0,34,0,34,0,65,0,65,0,0,0,8,0,4,0};
+const unsigned char helvetica12_222[] = {8,0,0,0,0,64,64,124,66,66,66,124,64,64,0,0,0};
+const unsigned char helvetica12_223[] = {7,0,0,0,0,88,68,68,68,88,68,68,68,56,0,0,0};
+const unsigned char helvetica12_224[] = {7,0,0,0,0,58,68,68,60,4,68,56,0,8,16,0,0};
+const unsigned char helvetica12_225[] = {7,0,0,0,0,58,68,68,60,4,68,56,0,16,8,0,0};
+const unsigned char helvetica12_226[] = {7,0,0,0,0,58,68,68,60,4,68,56,0,40,16,0,0};
+const unsigned char helvetica12_227[] = {7,0,0,0,0,58,68,68,60,4,68,56,0,40,20,0,0};
+const unsigned char helvetica12_228[] = {7,0,0,0,0,58,68,68,60,4,68,56,0,40,0,0,0};
+const unsigned char helvetica12_229[] = {7,0,0,0,0,58,68,68,60,4,68,56,24,36,24,0,0};
+const unsigned char helvetica12_230[] = {11,0,0,0,0,0,0,0,0,59,128,68,64,68,0,63,192,4,64,68,64,59,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica12_231[] = {7,0,48,8,16,56,68,64,64,64,68,56,0,0,0,0,0};
+const unsigned char helvetica12_232[] = {7,0,0,0,0,56,68,64,124,68,68,56,0,16,32,0,0};
+const unsigned char helvetica12_233[] = {7,0,0,0,0,56,68,64,124,68,68,56,0,16,8,0,0};
+const unsigned char helvetica12_234[] = {7,0,0,0,0,56,68,64,124,68,68,56,0,40,16,0,0};
+const unsigned char helvetica12_235[] = {7,0,0,0,0,56,68,64,124,68,68,56,0,40,0,0,0};
+const unsigned char helvetica12_236[] = {3,0,0,0,0,64,64,64,64,64,64,64,0,64,128,0,0};
+const unsigned char helvetica12_237[] = {3,0,0,0,0,64,64,64,64,64,64,64,0,64,32,0,0};
+const unsigned char helvetica12_238[] = {3,0,0,0,0,64,64,64,64,64,64,64,0,160,64,0,0};
+const unsigned char helvetica12_239[] = {3,0,0,0,0,64,64,64,64,64,64,64,0,160,0,0,0};
+const unsigned char helvetica12_240[] = {7,0,0,0,0,56,68,68,68,68,60,4,40,24,52,0,0};
+const unsigned char helvetica12_241[] = {7,0,0,0,0,68,68,68,68,68,100,88,0,40,20,0,0};
+const unsigned char helvetica12_242[] = {7,0,0,0,0,56,68,68,68,68,68,56,0,16,32,0,0};
+const unsigned char helvetica12_243[] = {7,0,0,0,0,56,68,68,68,68,68,56,0,16,8,0,0};
+const unsigned char helvetica12_244[] = {7,0,0,0,0,56,68,68,68,68,68,56,0,40,16,0,0};
+const unsigned char helvetica12_245[] = {7,0,0,0,0,56,68,68,68,68,68,56,0,40,20,0,0};
+const unsigned char helvetica12_246[] = {7,0,0,0,0,56,68,68,68,68,68,56,0,40,0,0,0};
+const unsigned char helvetica12_247[] = {7,0,0,0,0,0,16,0,124,0,16,0,0,0,0,0,0};
+const unsigned char helvetica12_248[] = {7,0,0,0,0,184,68,100,84,76,68,58,0,0,0,0,0};
+const unsigned char helvetica12_249[] = {7,0,0,0,0,52,76,68,68,68,68,68,0,16,32,0,0};
+const unsigned char helvetica12_250[] = {7,0,0,0,0,52,76,68,68,68,68,68,0,16,8,0,0};
+const unsigned char helvetica12_251[] = {7,0,0,0,0,52,76,68,68,68,68,68,0,40,16,0,0};
+const unsigned char helvetica12_252[] = {7,0,0,0,0,52,76,68,68,68,68,68,0,40,0,0,0};
+const unsigned char helvetica12_253[] = {7,0,64,32,16,16,40,40,72,68,68,68,0,16,8,0,0};
+const unsigned char helvetica12_254[] = {7,0,64,64,64,88,100,68,68,68,100,88,64,64,0,0,0};
+const unsigned char helvetica12_255[] = {7,0,96,16,16,16,24,40,40,36,68,68,0,40,0,0,0};
+const unsigned char *const helvetica12Glyphs[] = {helvetica12_0,helvetica12_1,helvetica12_2,helvetica12_3,helvetica12_4,helvetica12_5,helvetica12_6,helvetica12_7,helvetica12_8,helvetica12_9,helvetica12_10,helvetica12_11,helvetica12_12,helvetica12_13,helvetica12_14,helvetica12_15,helvetica12_16,helvetica12_17,helvetica12_18,helvetica12_19,helvetica12_20,helvetica12_21,helvetica12_22,helvetica12_23,helvetica12_24,helvetica12_25,helvetica12_26,helvetica12_27,helvetica12_28,helvetica12_29,helvetica12_30,helvetica12_31,helvetica12_32,helvetica12_33,helvetica12_34,helvetica12_35,helvetica12_36,helvetica12_37,helvetica12_38,helvetica12_39,helvetica12_40,helvetica12_41,helvetica12_42,helvetica12_43,helvetica12_44,helvetica12_45,helvetica12_46,helvetica12_47,helvetica12_48,helvetica12_49,helvetica12_50,helvetica12_51,helvetica12_52,helvetica12_53,helvetica12_54,helvetica12_55,helvetica12_56,helvetica12_57,helvetica12_58,helvetica12_59,helvetica12_60,helvetica12_61,helvetica12_62,helvetica12_63,helvetica12_64,helvetica12_65,helvetica12_66,helvetica12_67,helvetica12_68,helvetica12_69,helvetica12_70,helvetica12_71,helvetica12_72,helvetica12_73,helvetica12_74,helvetica12_75,helvetica12_76,helvetica12_77,helvetica12_78,helvetica12_79,helvetica12_80,helvetica12_81,helvetica12_82,helvetica12_83,helvetica12_84,helvetica12_85,helvetica12_86,helvetica12_87,helvetica12_88,helvetica12_89,helvetica12_90,helvetica12_91,helvetica12_92,helvetica12_93,helvetica12_94,helvetica12_95,helvetica12_96,helvetica12_97,helvetica12_98,helvetica12_99,helvetica12_100,helvetica12_101,helvetica12_102,helvetica12_103,helvetica12_104,helvetica12_105,helvetica12_106,helvetica12_107,helvetica12_108,helvetica12_109,helvetica12_110,helvetica12_111,helvetica12_112,helvetica12_113,helvetica12_114,helvetica12_115,helvetica12_116,helvetica12_117,helvetica12_118,helvetica12_119,helvetica12_120,helvetica12_121,helvetica12_122,helvetica12_123,helvetica12_124,helvetica12_125,helvetica12_126,helvetica12_127,helvetica12_128,helvetica12_129,helvetica12_130,helvetica12_131,helvetica12_132,helvetica12_133,helvetica12_134,helvetica12_135,helvetica12_136,helvetica12_137,helvetica12_138,helvetica12_139,helvetica12_140,helvetica12_141,helvetica12_142,helvetica12_143,helvetica12_144,helvetica12_145,helvetica12_146,helvetica12_147,helvetica12_148,helvetica12_149,helvetica12_150,helvetica12_151,helvetica12_152,helvetica12_153,helvetica12_154,helvetica12_155,helvetica12_156,helvetica12_157,helvetica12_158,helvetica12_159,helvetica12_160,helvetica12_161,helvetica12_162,helvetica12_163,helvetica12_164,helvetica12_165,helvetica12_166,helvetica12_167,helvetica12_168,helvetica12_169,helvetica12_170,helvetica12_171,helvetica12_172,helvetica12_173,helvetica12_174,helvetica12_175,helvetica12_176,helvetica12_177,helvetica12_178,helvetica12_179,helvetica12_180,helvetica12_181,helvetica12_182,helvetica12_183,helvetica12_184,helvetica12_185,helvetica12_186,helvetica12_187,helvetica12_188,helvetica12_189,helvetica12_190,helvetica12_191,helvetica12_192,helvetica12_193,helvetica12_194,helvetica12_195,helvetica12_196,helvetica12_197,helvetica12_198,helvetica12_199,helvetica12_200,helvetica12_201,helvetica12_202,helvetica12_203,helvetica12_204,helvetica12_205,helvetica12_206,helvetica12_207,helvetica12_208,helvetica12_209,helvetica12_210,helvetica12_211,helvetica12_212,helvetica12_213,helvetica12_214,helvetica12_215,helvetica12_216,helvetica12_217,helvetica12_218,helvetica12_219,helvetica12_220,helvetica12_221,helvetica12_222,helvetica12_223,helvetica12_224,helvetica12_225,helvetica12_226,helvetica12_227,helvetica12_228,helvetica12_229,helvetica12_230,helvetica12_231,helvetica12_232,helvetica12_233,helvetica12_234,helvetica12_235,helvetica12_236,helvetica12_237,helvetica12_238,helvetica12_239,helvetica12_240,helvetica12_241,helvetica12_242,helvetica12_243,helvetica12_244,helvetica12_245,helvetica12_246,helvetica12_247,helvetica12_248,helvetica12_249,helvetica12_250,helvetica12_251,helvetica12_252,helvetica12_253,helvetica12_254,helvetica12_255};
+
+// ===== Helvetica 18 =====
+const unsigned char helvetica18_0[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_1[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_2[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_3[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_4[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_5[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_6[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_7[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_8[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_9[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_10[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_11[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_12[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_13[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_14[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_15[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_16[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_17[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_18[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_19[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_20[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_21[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_22[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_23[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_24[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_25[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_26[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_27[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_28[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_29[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_30[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_31[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_32[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_33[] = {6,0,0,0,0,0,48,48,0,0,32,32,48,48,48,48,48,48,48,48,0,0,0,0};
+const unsigned char helvetica18_34[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,144,216,216,216,0,0,0,0};
+const unsigned char helvetica18_35[] = {10,0,0,0,0,0,0,0,0,0,0,36,0,36,0,36,0,255,128,255,128,18,0,18,0,18,0,127,192,127,192,9,0,9,0,9,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_36[] = {10,0,0,0,0,0,0,4,0,4,0,31,0,63,128,117,192,100,192,4,192,7,128,31,0,60,0,116,0,100,0,101,128,63,128,31,0,4,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_37[] = {16,0,0,0,0,0,0,0,0,0,0,12,60,12,126,6,102,6,102,3,126,3,60,1,128,61,128,126,192,102,192,102,96,126,96,60,48,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_38[] = {13,0,0,0,0,0,0,0,0,0,0,30,56,63,112,115,224,97,192,97,224,99,96,119,96,62,0,30,0,51,0,51,0,63,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_39[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,32,32,96,96,0,0,0,0};
+const unsigned char helvetica18_40[] = {6,0,8,24,48,48,96,96,96,96,96,96,96,96,96,96,48,48,24,8,0,0,0,0};
+const unsigned char helvetica18_41[] = {6,0,64,96,48,48,24,24,24,24,24,24,24,24,24,24,48,48,96,64,0,0,0,0};
+const unsigned char helvetica18_42[] = {7,0,0,0,0,0,0,0,0,0,0,0,0,0,68,56,56,124,16,16,0,0,0,0};
+const unsigned char helvetica18_43[] = {10,0,0,0,0,0,0,0,0,0,0,12,0,12,0,12,0,12,0,127,128,127,128,12,0,12,0,12,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_44[] = {5,0,0,64,32,32,96,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_45[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,128,127,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_46[] = {5,0,0,0,0,0,96,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_47[] = {5,0,0,0,0,0,192,192,64,64,96,96,32,32,48,48,16,16,24,24,0,0,0,0};
+const unsigned char helvetica18_48[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,0,51,0,97,128,97,128,97,128,97,128,97,128,97,128,97,128,51,0,63,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_49[] = {10,0,0,0,0,0,0,0,0,0,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,62,0,62,0,6,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_50[] = {10,0,0,0,0,0,0,0,0,0,0,127,128,127,128,96,0,112,0,56,0,28,0,14,0,7,0,3,128,1,128,97,128,127,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_51[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,0,99,128,97,128,1,128,3,128,15,0,14,0,3,0,97,128,97,128,63,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_52[] = {10,0,0,0,0,0,0,0,0,0,0,1,128,1,128,1,128,127,192,127,192,97,128,49,128,25,128,25,128,13,128,7,128,3,128,1,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_53[] = {10,0,0,0,0,0,0,0,0,0,0,62,0,127,0,99,128,97,128,1,128,1,128,99,128,127,0,126,0,96,0,96,0,127,0,127,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_54[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,0,113,128,97,128,97,128,97,128,127,0,110,0,96,0,96,0,49,128,63,128,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_55[] = {10,0,0,0,0,0,0,0,0,0,0,48,0,48,0,24,0,24,0,24,0,12,0,12,0,6,0,6,0,3,0,1,128,127,128,127,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_56[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,0,115,128,97,128,97,128,51,0,63,0,51,0,97,128,97,128,115,128,63,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_57[] = {10,0,0,0,0,0,0,0,0,0,0,62,0,127,0,99,0,1,128,1,128,29,128,63,128,97,128,97,128,97,128,99,128,63,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_58[] = {5,0,0,0,0,0,96,96,0,0,0,0,0,0,96,96,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_59[] = {5,0,0,64,32,32,96,96,0,0,0,0,0,0,96,96,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_60[] = {10,0,0,0,0,0,0,0,0,0,0,1,128,7,128,30,0,56,0,96,0,56,0,30,0,7,128,1,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_61[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,128,63,128,0,0,0,0,63,128,63,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_62[] = {10,0,0,0,0,0,0,0,0,0,0,96,0,120,0,30,0,7,0,1,128,7,0,30,0,120,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_63[] = {10,0,0,0,0,0,0,0,0,0,0,24,0,24,0,0,0,0,0,24,0,24,0,24,0,28,0,14,0,7,0,99,0,99,0,127,0,62,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_64[] = {18,0,0,0,0,0,0,3,240,0,15,248,0,28,0,0,56,0,0,51,184,0,103,252,0,102,102,0,102,51,0,102,51,0,102,49,128,99,25,128,51,185,128,49,217,128,24,3,0,14,7,0,7,254,0,1,248,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_65[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_66[] = {13,0,0,0,0,0,0,0,0,0,0,127,192,127,224,96,112,96,48,96,48,96,112,127,224,127,192,96,192,96,96,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_67[] = {14,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,0,96,0,96,0,96,0,96,0,112,0,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_68[] = {13,0,0,0,0,0,0,0,0,0,0,127,128,127,192,96,224,96,96,96,48,96,48,96,48,96,48,96,48,96,48,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_69[] = {11,0,0,0,0,0,0,0,0,0,0,127,192,127,192,96,0,96,0,96,0,96,0,127,128,127,128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_70[] = {11,0,0,0,0,0,0,0,0,0,0,96,0,96,0,96,0,96,0,96,0,96,0,127,128,127,128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_71[] = {14,0,0,0,0,0,0,0,0,0,0,7,216,31,248,56,56,48,24,112,24,96,248,96,248,96,0,96,0,112,24,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_72[] = {13,0,0,0,0,0,0,0,0,0,0,96,48,96,48,96,48,96,48,96,48,96,48,127,240,127,240,96,48,96,48,96,48,96,48,96,48,96,48,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_73[] = {6,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,0,0};
+const unsigned char helvetica18_74[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,0,115,128,97,128,97,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_75[] = {13,0,0,0,0,0,0,0,0,0,0,96,56,96,112,96,224,97,192,99,128,103,0,126,0,124,0,110,0,103,0,99,128,97,192,96,224,96,112,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_76[] = {10,0,0,0,0,0,0,0,0,0,0,127,128,127,128,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_77[] = {16,0,0,0,0,0,0,0,0,0,0,97,134,97,134,99,198,98,70,102,102,102,102,108,54,108,54,120,30,120,30,112,14,112,14,96,6,96,6,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_78[] = {13,0,0,0,0,0,0,0,0,0,0,96,48,96,112,96,240,96,240,97,176,99,48,99,48,102,48,102,48,108,48,120,48,120,48,112,48,96,48,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_79[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_80[] = {12,0,0,0,0,0,0,0,0,0,0,96,0,96,0,96,0,96,0,96,0,96,0,127,128,127,192,96,224,96,96,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_81[] = {15,0,0,0,0,0,0,0,0,0,24,7,216,31,240,56,120,48,216,112,220,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_82[] = {12,0,0,0,0,0,0,0,0,0,0,96,96,96,96,96,96,96,96,96,192,96,192,127,128,127,192,96,224,96,96,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_83[] = {13,0,0,0,0,0,0,0,0,0,0,31,128,63,224,112,112,96,48,0,48,0,112,1,224,15,128,62,0,112,0,96,48,112,112,63,224,15,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_84[] = {12,0,0,0,0,0,0,0,0,0,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,127,224,127,224,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_85[] = {13,0,0,0,0,0,0,0,0,0,0,15,128,63,224,48,96,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_86[] = {14,0,0,0,0,0,0,0,0,0,0,3,0,7,128,7,128,12,192,12,192,12,192,24,96,24,96,24,96,48,48,48,48,48,48,96,24,96,24,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_87[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,0,12,12,0,14,28,0,26,22,0,27,54,0,27,54,0,51,51,0,51,51,0,49,35,0,49,227,0,97,225,128,96,193,128,96,193,128,96,193,128,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_88[] = {13,0,0,0,0,0,0,0,0,0,0,96,48,112,112,48,96,56,224,24,192,13,128,7,0,7,0,13,128,24,192,56,224,48,96,112,112,96,48,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_89[] = {14,0,0,0,0,0,0,0,0,0,0,3,0,3,0,3,0,3,0,3,0,3,0,7,128,12,192,24,96,24,96,48,48,48,48,96,24,96,24,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_90[] = {12,0,0,0,0,0,0,0,0,0,0,127,224,127,224,96,0,48,0,24,0,12,0,14,0,6,0,3,0,1,128,0,192,0,96,127,224,127,224,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_91[] = {5,0,120,120,96,96,96,96,96,96,96,96,96,96,96,96,96,96,120,120,0,0,0,0};
+const unsigned char helvetica18_92[] = {5,0,0,0,0,0,24,24,16,16,48,48,32,32,96,96,64,64,192,192,0,0,0,0};
+const unsigned char helvetica18_93[] = {5,0,240,240,48,48,48,48,48,48,48,48,48,48,48,48,48,48,240,240,0,0,0,0};
+const unsigned char helvetica18_94[] = {9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,99,0,54,0,28,0,8,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_95[] = {10,0,0,255,192,255,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_96[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,96,64,64,32,0,0,0,0};
+const unsigned char helvetica18_97[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_98[] = {11,0,0,0,0,0,0,0,0,0,0,111,0,127,128,113,128,96,192,96,192,96,192,96,192,113,128,127,128,111,0,96,0,96,0,96,0,96,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_99[] = {10,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,0,96,0,96,0,96,0,49,128,63,128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_100[] = {11,0,0,0,0,0,0,0,0,0,0,30,192,63,192,49,192,96,192,96,192,96,192,96,192,49,192,63,192,30,192,0,192,0,192,0,192,0,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_101[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,128,113,128,96,0,96,0,127,128,97,128,97,128,63,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_102[] = {6,0,0,0,0,0,48,48,48,48,48,48,48,48,252,252,48,48,60,28,0,0,0,0};
+const unsigned char helvetica18_103[] = {11,0,0,14,0,63,128,49,128,0,192,30,192,63,192,49,192,96,192,96,192,96,192,96,192,48,192,63,192,30,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_104[] = {10,0,0,0,0,0,0,0,0,0,0,97,128,97,128,97,128,97,128,97,128,97,128,97,128,113,128,111,128,103,0,96,0,96,0,96,0,96,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_105[] = {4,0,0,0,0,0,96,96,96,96,96,96,96,96,96,96,0,0,96,96,0,0,0,0};
+const unsigned char helvetica18_106[] = {4,0,192,224,96,96,96,96,96,96,96,96,96,96,96,96,0,0,96,96,0,0,0,0};
+const unsigned char helvetica18_107[] = {9,0,0,0,0,0,0,0,0,0,0,99,128,99,0,103,0,102,0,108,0,124,0,120,0,108,0,102,0,99,0,96,0,96,0,96,0,96,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_108[] = {4,0,0,0,0,0,96,96,96,96,96,96,96,96,96,96,96,96,96,96,0,0,0,0};
+const unsigned char helvetica18_109[] = {14,0,0,0,0,0,0,0,0,0,0,99,24,99,24,99,24,99,24,99,24,99,24,99,24,115,152,111,120,102,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_110[] = {10,0,0,0,0,0,0,0,0,0,0,97,128,97,128,97,128,97,128,97,128,97,128,97,128,113,128,111,128,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_111[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_112[] = {11,0,0,96,0,96,0,96,0,96,0,111,0,127,128,113,128,96,192,96,192,96,192,96,192,113,128,127,128,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_113[] = {11,0,0,0,192,0,192,0,192,0,192,30,192,63,192,49,192,96,192,96,192,96,192,96,192,49,192,63,192,30,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_114[] = {6,0,0,0,0,0,96,96,96,96,96,96,96,112,108,108,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_115[] = {9,0,0,0,0,0,0,0,0,0,0,60,0,126,0,99,0,3,0,31,0,126,0,96,0,99,0,63,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_116[] = {6,0,0,0,0,0,24,56,48,48,48,48,48,48,252,252,48,48,48,0,0,0,0,0};
+const unsigned char helvetica18_117[] = {10,0,0,0,0,0,0,0,0,0,0,57,128,125,128,99,128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_118[] = {10,0,0,0,0,0,0,0,0,0,0,12,0,12,0,30,0,18,0,51,0,51,0,51,0,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_119[] = {14,0,0,0,0,0,0,0,0,0,0,12,192,12,192,28,224,20,160,52,176,51,48,51,48,99,24,99,24,99,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_120[] = {10,0,0,0,0,0,0,0,0,0,0,97,128,115,128,51,0,30,0,12,0,12,0,30,0,51,0,115,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_121[] = {10,0,0,56,0,56,0,12,0,12,0,12,0,12,0,30,0,18,0,51,0,51,0,51,0,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_122[] = {9,0,0,0,0,0,0,0,0,0,0,127,0,127,0,96,0,48,0,24,0,12,0,6,0,3,0,127,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_123[] = {6,0,12,24,48,48,48,48,48,48,96,192,96,48,48,48,48,48,24,12,0,0,0,0};
+const unsigned char helvetica18_124[] = {4,0,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,0,0,0,0};
+const unsigned char helvetica18_125[] = {6,0,192,96,48,48,48,48,48,48,24,12,24,48,48,48,48,48,96,192,0,0,0,0};
+const unsigned char helvetica18_126[] = {10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,63,0,25,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_127[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_128[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_129[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_130[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_131[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_132[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_133[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_134[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_135[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_136[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_137[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_138[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_139[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_140[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_141[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_142[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_143[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_144[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_145[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_146[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_147[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_148[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_149[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_150[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_151[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_152[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_153[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_154[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_155[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_156[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_157[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_158[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_159[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_160[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_161[] = {6,0,48,48,48,48,48,48,48,48,16,16,0,0,48,48,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_162[] = {10,0,0,0,0,0,0,8,0,8,0,31,0,63,128,53,128,100,0,100,0,100,0,100,0,53,128,63,128,31,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_163[] = {10,0,0,0,0,0,0,0,0,0,0,223,0,255,128,96,128,48,0,24,0,24,0,126,0,48,0,96,0,97,128,97,128,63,0,30,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_164[] = {10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,128,127,128,51,0,51,0,51,0,127,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_165[] = {10,0,0,0,0,0,0,0,0,0,0,12,0,12,0,12,0,12,0,127,128,12,0,127,128,30,0,51,0,51,0,51,0,97,128,97,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_166[] = {4,0,0,96,96,96,96,96,96,0,0,0,0,96,96,96,96,96,96,96,0,0,0,0};
+const unsigned char helvetica18_167[] = {10,0,0,30,0,63,0,97,128,97,128,3,128,7,0,31,0,57,128,113,128,97,128,99,128,55,0,62,0,120,0,97,128,97,128,63,0,30,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_168[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,216,0,0,0,0,0};
+const unsigned char helvetica18_169[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,24,48,32,8,35,136,68,68,72,4,72,4,72,4,68,68,35,136,32,8,24,48,7,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_170[] = {7,0,0,0,0,0,0,0,0,0,0,0,124,0,52,108,36,28,100,56,0,0,0,0};
+const unsigned char helvetica18_171[] = {9,0,0,0,0,0,0,0,0,0,0,0,0,9,0,27,0,54,0,108,0,108,0,54,0,27,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_172[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,0,192,0,192,127,192,127,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_173[] = {7,0,0,0,0,0,0,0,0,0,124,124,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_174[] = {14,0,0,0,0,0,0,0,0,0,0,7,192,24,48,32,8,36,40,68,68,68,132,71,196,68,36,68,36,39,200,32,8,24,48,7,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_175[] = {5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,0,0,0,0,0};
+const unsigned char helvetica18_176[] = {7,0,0,0,0,0,0,0,0,0,0,0,0,0,56,108,68,108,56,0,0,0,0,0};
+const unsigned char helvetica18_177[] = {10,0,0,0,0,0,0,0,0,0,0,127,128,127,128,0,0,12,0,12,0,12,0,127,128,127,128,12,0,12,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_178[] = {6,0,0,0,0,0,0,0,0,0,0,248,248,96,48,24,152,248,112,0,0,0,0,0};
+const unsigned char helvetica18_179[] = {6,0,0,0,0,0,0,0,0,0,0,112,248,152,48,48,152,248,112,0,0,0,0,0};
+const unsigned char helvetica18_180[] = {4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,96,48,0,0,0,0};
+const unsigned char helvetica18_181[] = {10,0,0,96,0,96,0,96,0,96,0,109,128,127,128,115,128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_182[] = {10,0,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,25,0,57,0,121,0,121,0,121,0,121,0,57,0,31,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_183[] = {4,0,0,0,0,0,0,0,0,0,96,96,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_184[] = {5,0,240,216,24,112,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_185[] = {6,0,0,0,0,0,0,0,0,0,0,48,48,48,48,48,112,112,48,0,0,0,0,0};
+const unsigned char helvetica18_186[] = {7,0,0,0,0,0,0,0,0,0,0,0,124,0,56,108,68,68,108,56,0,0,0,0};
+const unsigned char helvetica18_187[] = {9,0,0,0,0,0,0,0,0,0,0,0,0,72,0,108,0,54,0,27,0,27,0,54,0,108,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_188[] = {15,0,0,0,0,0,0,0,0,0,0,24,24,24,24,12,252,6,216,6,120,51,56,49,24,49,136,48,192,48,192,112,96,112,48,48,48,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_189[] = {15,0,0,0,0,0,0,0,0,0,0,24,124,24,124,12,48,6,24,6,12,51,76,49,124,49,184,48,192,48,192,112,96,112,48,48,48,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_190[] = {15,0,0,0,0,0,0,0,0,0,0,24,24,24,24,12,252,6,216,6,120,115,56,249,24,153,136,48,192,48,192,152,96,248,48,112,48,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_191[] = {10,0,0,62,0,127,0,99,0,99,0,112,0,56,0,28,0,12,0,12,0,12,0,0,0,0,0,12,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_192[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,6,0,12,0,24,0};
+const unsigned char helvetica18_193[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,6,0,3,0,1,128};
+const unsigned char helvetica18_194[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,25,128,15,0,6,0};
+const unsigned char helvetica18_195[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,19,0,22,128,12,128};
+const unsigned char helvetica18_196[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,25,128,25,128,0,0};
+const unsigned char helvetica18_197[] = {12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,15,0,25,128,25,128,15,0};
+const unsigned char helvetica18_198[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,255,128,96,255,128,48,192,0,48,192,0,63,192,0,31,192,0,24,255,0,24,255,0,12,192,0,12,192,0,6,192,0,6,192,0,3,255,128,3,255,128,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_199[] = {14,0,0,15,0,13,128,1,128,7,0,7,192,31,240,56,56,48,24,112,0,96,0,96,0,96,0,96,0,112,0,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_200[] = {11,0,0,0,0,0,0,0,0,0,0,127,192,127,192,96,0,96,0,96,0,96,0,127,128,127,128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,6,0,12,0,24,0};
+const unsigned char helvetica18_201[] = {11,0,0,0,0,0,0,0,0,0,0,127,192,127,192,96,0,96,0,96,0,96,0,127,128,127,128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,6,0,3,0,1,128};
+const unsigned char helvetica18_202[] = {11,0,0,0,0,0,0,0,0,0,0,127,192,127,192,96,0,96,0,96,0,96,0,127,128,127,128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,25,128,15,0,6,0};
+const unsigned char helvetica18_203[] = {11,0,0,0,0,0,0,0,0,0,0,127,192,127,192,96,0,96,0,96,0,96,0,127,128,127,128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,25,128,25,128,0,0};
+const unsigned char helvetica18_204[] = {6,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,96,192};
+const unsigned char helvetica18_205[] = {6,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,24,12};
+const unsigned char helvetica18_206[] = {6,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,204,120,48};
+const unsigned char helvetica18_207[] = {6,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,204,204,0};
+const unsigned char helvetica18_208[] = {13,0,0,0,0,0,0,0,0,0,0,127,128,127,192,96,224,96,96,96,48,96,48,252,48,252,48,96,48,96,48,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_209[] = {13,0,0,0,0,0,0,0,0,0,0,96,48,96,112,96,240,96,240,97,176,99,48,99,48,102,48,102,48,108,48,108,48,120,48,112,48,112,48,0,0,9,128,11,64,6,64};
+const unsigned char helvetica18_210[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,1,128,3,0,6,0};
+const unsigned char helvetica18_211[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,1,128,0,192,0,96};
+const unsigned char helvetica18_212[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,6,96,3,192,1,128};
+const unsigned char helvetica18_213[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,4,192,5,160,3,32};
+const unsigned char helvetica18_214[] = {15,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,7,192,0,0,6,192,6,192,0,0};
+const unsigned char helvetica18_215[] = {10,0,0,0,0,0,0,0,0,0,0,192,192,97,128,51,0,30,0,12,0,30,0,51,0,97,128,192,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_216[] = {15,0,0,0,0,0,0,0,0,0,0,199,192,255,240,120,56,56,24,108,28,110,12,103,12,99,140,97,204,112,220,48,120,56,56,31,252,7,204,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_217[] = {13,0,0,0,0,0,0,0,0,0,0,15,128,63,224,48,96,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,0,0,3,0,6,0,12,0};
+const unsigned char helvetica18_218[] = {13,0,0,0,0,0,0,0,0,0,0,15,128,63,224,48,96,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,0,0,6,0,3,0,1,128};
+const unsigned char helvetica18_219[] = {13,0,0,0,0,0,0,0,0,0,0,15,128,63,224,48,96,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,0,0,12,192,7,128,3,0};
+const unsigned char helvetica18_220[] = {13,0,0,0,0,0,0,0,0,0,0,15,128,63,224,48,96,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,0,0,12,192,12,192,0,0};
+const unsigned char helvetica18_221[] = {14,0,0,0,0,0,0,0,0,0,0,3,0,3,0,3,0,3,0,3,0,3,0,7,128,12,192,24,96,24,96,48,48,48,48,96,24,96,24,0,0,3,0,1,128,0,192};
+const unsigned char helvetica18_222[] = {12,0,0,0,0,0,0,0,0,0,0,96,0,96,0,96,0,127,128,127,192,96,224,96,96,96,96,96,224,127,192,127,128,96,0,96,0,96,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_223[] = {9,0,0,0,0,0,0,0,0,0,0,110,0,111,0,99,0,99,0,99,0,99,0,110,0,110,0,99,0,99,0,99,0,99,0,62,0,28,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_224[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,0,0,12,0,24,0,48,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_225[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,0,0,24,0,12,0,6,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_226[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,0,0,51,0,30,0,12,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_227[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,0,0,38,0,45,0,25,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_228[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,0,0,54,0,54,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_229[] = {9,0,0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,0,119,0,62,0,28,0,54,0,54,0,28,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_230[] = {15,0,0,0,0,0,0,0,0,0,0,58,240,119,252,99,140,99,0,115,0,63,252,7,12,99,12,119,248,62,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_231[] = {10,0,0,60,0,54,0,6,0,28,0,31,0,63,128,49,128,96,0,96,0,96,0,96,0,49,128,63,128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_232[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,128,113,128,96,0,96,0,127,128,97,128,97,128,63,0,30,0,0,0,12,0,24,0,48,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_233[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,128,113,128,96,0,96,0,127,128,97,128,97,128,63,0,30,0,0,0,12,0,6,0,3,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_234[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,128,113,128,96,0,96,0,127,128,97,128,97,128,63,0,30,0,0,0,51,0,30,0,12,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_235[] = {10,0,0,0,0,0,0,0,0,0,0,30,0,63,128,113,128,96,0,96,0,127,128,97,128,97,128,63,0,30,0,0,0,27,0,27,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_236[] = {4,0,0,0,0,0,96,96,96,96,96,96,96,96,96,96,0,48,96,192,0,0,0,0};
+const unsigned char helvetica18_237[] = {4,0,0,0,0,0,96,96,96,96,96,96,96,96,96,96,0,192,96,48,0,0,0,0};
+const unsigned char helvetica18_238[] = {4,0,0,0,0,0,96,96,96,96,96,96,96,96,96,96,0,144,240,96,0,0,0,0};
+const unsigned char helvetica18_239[] = {4,0,0,0,0,0,96,96,96,96,96,96,96,96,96,96,0,216,216,0,0,0,0,0};
+const unsigned char helvetica18_240[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,38,0,28,0,27,0,48,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_241[] = {10,0,0,0,0,0,0,0,0,0,0,97,128,97,128,97,128,97,128,97,128,97,128,97,128,113,128,111,128,103,0,0,0,38,0,45,0,25,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_242[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,6,0,12,0,24,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_243[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,12,0,6,0,3,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_244[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,25,128,15,0,6,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_245[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,19,0,22,128,12,128,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_246[] = {11,0,0,0,0,0,0,0,0,0,0,31,0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,27,0,27,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_247[] = {10,0,0,0,0,0,0,0,0,0,0,0,0,12,0,12,0,0,0,127,128,127,128,0,0,12,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_248[] = {11,0,0,0,0,0,0,0,0,0,0,206,0,127,128,49,128,120,192,108,192,102,192,99,192,49,128,63,192,14,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_249[] = {10,0,0,0,0,0,0,0,0,0,0,57,128,125,128,99,128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,6,0,12,0,24,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_250[] = {10,0,0,0,0,0,0,0,0,0,0,57,128,125,128,99,128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,12,0,6,0,3,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_251[] = {10,0,0,0,0,0,0,0,0,0,0,57,128,125,128,99,128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,51,0,30,0,12,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_252[] = {10,0,0,0,0,0,0,0,0,0,0,57,128,125,128,99,128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,51,0,51,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_253[] = {10,0,0,56,0,56,0,12,0,12,0,12,0,12,0,30,0,18,0,51,0,51,0,51,0,97,128,97,128,97,128,0,0,12,0,6,0,3,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_254[] = {11,0,0,96,0,96,0,96,0,96,0,111,0,127,128,113,128,96,192,96,192,96,192,96,192,113,128,127,128,111,0,96,0,96,0,96,0,96,0,0,0,0,0,0,0,0,0};
+const unsigned char helvetica18_255[] = {10,0,0,56,0,56,0,12,0,12,0,12,0,12,0,30,0,18,0,51,0,51,0,51,0,97,128,97,128,97,128,0,0,51,0,51,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char *const helvetica18Glyphs[] = {helvetica18_0,helvetica18_1,helvetica18_2,helvetica18_3,helvetica18_4,helvetica18_5,helvetica18_6,helvetica18_7,helvetica18_8,helvetica18_9,helvetica18_10,helvetica18_11,helvetica18_12,helvetica18_13,helvetica18_14,helvetica18_15,helvetica18_16,helvetica18_17,helvetica18_18,helvetica18_19,helvetica18_20,helvetica18_21,helvetica18_22,helvetica18_23,helvetica18_24,helvetica18_25,helvetica18_26,helvetica18_27,helvetica18_28,helvetica18_29,helvetica18_30,helvetica18_31,helvetica18_32,helvetica18_33,helvetica18_34,helvetica18_35,helvetica18_36,helvetica18_37,helvetica18_38,helvetica18_39,helvetica18_40,helvetica18_41,helvetica18_42,helvetica18_43,helvetica18_44,helvetica18_45,helvetica18_46,helvetica18_47,helvetica18_48,helvetica18_49,helvetica18_50,helvetica18_51,helvetica18_52,helvetica18_53,helvetica18_54,helvetica18_55,helvetica18_56,helvetica18_57,helvetica18_58,helvetica18_59,helvetica18_60,helvetica18_61,helvetica18_62,helvetica18_63,helvetica18_64,helvetica18_65,helvetica18_66,helvetica18_67,helvetica18_68,helvetica18_69,helvetica18_70,helvetica18_71,helvetica18_72,helvetica18_73,helvetica18_74,helvetica18_75,helvetica18_76,helvetica18_77,helvetica18_78,helvetica18_79,helvetica18_80,helvetica18_81,helvetica18_82,helvetica18_83,helvetica18_84,helvetica18_85,helvetica18_86,helvetica18_87,helvetica18_88,helvetica18_89,helvetica18_90,helvetica18_91,helvetica18_92,helvetica18_93,helvetica18_94,helvetica18_95,helvetica18_96,helvetica18_97,helvetica18_98,helvetica18_99,helvetica18_100,helvetica18_101,helvetica18_102,helvetica18_103,helvetica18_104,helvetica18_105,helvetica18_106,helvetica18_107,helvetica18_108,helvetica18_109,helvetica18_110,helvetica18_111,helvetica18_112,helvetica18_113,helvetica18_114,helvetica18_115,helvetica18_116,helvetica18_117,helvetica18_118,helvetica18_119,helvetica18_120,helvetica18_121,helvetica18_122,helvetica18_123,helvetica18_124,helvetica18_125,helvetica18_126,helvetica18_127,helvetica18_128,helvetica18_129,helvetica18_130,helvetica18_131,helvetica18_132,helvetica18_133,helvetica18_134,helvetica18_135,helvetica18_136,helvetica18_137,helvetica18_138,helvetica18_139,helvetica18_140,helvetica18_141,helvetica18_142,helvetica18_143,helvetica18_144,helvetica18_145,helvetica18_146,helvetica18_147,helvetica18_148,helvetica18_149,helvetica18_150,helvetica18_151,helvetica18_152,helvetica18_153,helvetica18_154,helvetica18_155,helvetica18_156,helvetica18_157,helvetica18_158,helvetica18_159,helvetica18_160,helvetica18_161,helvetica18_162,helvetica18_163,helvetica18_164,helvetica18_165,helvetica18_166,helvetica18_167,helvetica18_168,helvetica18_169,helvetica18_170,helvetica18_171,helvetica18_172,helvetica18_173,helvetica18_174,helvetica18_175,helvetica18_176,helvetica18_177,helvetica18_178,helvetica18_179,helvetica18_180,helvetica18_181,helvetica18_182,helvetica18_183,helvetica18_184,helvetica18_185,helvetica18_186,helvetica18_187,helvetica18_188,helvetica18_189,helvetica18_190,helvetica18_191,helvetica18_192,helvetica18_193,helvetica18_194,helvetica18_195,helvetica18_196,helvetica18_197,helvetica18_198,helvetica18_199,helvetica18_200,helvetica18_201,helvetica18_202,helvetica18_203,helvetica18_204,helvetica18_205,helvetica18_206,helvetica18_207,helvetica18_208,helvetica18_209,helvetica18_210,helvetica18_211,helvetica18_212,helvetica18_213,helvetica18_214,helvetica18_215,helvetica18_216,helvetica18_217,helvetica18_218,helvetica18_219,helvetica18_220,helvetica18_221,helvetica18_222,helvetica18_223,helvetica18_224,helvetica18_225,helvetica18_226,helvetica18_227,helvetica18_228,helvetica18_229,helvetica18_230,helvetica18_231,helvetica18_232,helvetica18_233,helvetica18_234,helvetica18_235,helvetica18_236,helvetica18_237,helvetica18_238,helvetica18_239,helvetica18_240,helvetica18_241,helvetica18_242,helvetica18_243,helvetica18_244,helvetica18_245,helvetica18_246,helvetica18_247,helvetica18_248,helvetica18_249,helvetica18_250,helvetica18_251,helvetica18_252,helvetica18_253,helvetica18_254,helvetica18_255};
+
+// ===== Times Roman 24 =====
+const unsigned char timesRoman24_0[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_1[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_2[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_3[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_4[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_5[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_6[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_7[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_8[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_9[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_10[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_11[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_12[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_13[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_14[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_15[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_16[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_17[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_18[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_19[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_20[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_21[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_22[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_23[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_24[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_25[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_26[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_27[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_28[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_29[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_30[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_31[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_32[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_33[] = {8,0,0,0,0,0,0,0,24,24,0,0,0,24,24,24,24,24,24,24,24,24,24,24,24,0,0,0,0,0};
+const unsigned char timesRoman24_34[] = {10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,102,0,102,0,102,0,102,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_35[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,17,0,17,0,17,0,17,0,127,224,127,224,8,128,8,128,8,128,63,240,63,240,4,64,4,64,4,64,4,64,4,64,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_36[] = {12,0,0,0,0,0,0,0,0,0,0,4,0,4,0,63,0,229,192,196,192,132,96,132,96,4,96,4,224,7,192,7,128,30,0,60,0,116,0,100,0,100,32,100,96,52,224,31,128,4,0,4,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_37[] = {19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,30,0,12,57,0,6,48,128,2,48,64,3,48,64,1,152,64,0,140,192,0,199,128,60,96,0,114,32,0,97,48,0,96,152,0,96,136,0,48,140,0,25,254,0,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_38[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,0,63,191,0,112,240,128,96,96,0,96,224,0,96,208,0,49,144,0,27,136,0,15,12,0,7,31,0,7,128,0,14,192,0,12,96,0,12,32,0,12,32,0,6,96,0,3,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_39[] = {8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,12,4,28,24,0,0,0,0,0,0};
+const unsigned char timesRoman24_40[] = {8,0,0,2,4,8,24,16,48,48,96,96,96,96,96,96,96,96,48,48,16,24,8,4,2,0,0,0,0,0};
+const unsigned char timesRoman24_41[] = {8,0,0,64,32,16,24,8,12,12,6,6,6,6,6,6,6,6,12,12,8,24,16,32,64,0,0,0,0,0};
+const unsigned char timesRoman24_42[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,7,0,50,96,58,224,7,0,58,224,50,96,7,0,2,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_43[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,3,0,3,0,3,0,3,0,127,248,127,248,3,0,3,0,3,0,3,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_44[] = {7,0,0,0,0,48,24,8,56,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_45[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,248,127,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_46[] = {6,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_47[] = {7,0,0,0,0,192,192,192,64,96,96,32,48,48,16,24,24,8,12,12,4,6,6,6,6,0,0,0,0,0};
+const unsigned char timesRoman24_48[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,25,128,48,192,48,192,112,224,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,48,192,48,192,25,128,15,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_49[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,192,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,30,0,6,0,2,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_50[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,192,127,224,48,32,24,0,12,0,6,0,2,0,3,0,1,128,1,128,0,192,0,192,64,192,64,192,33,192,63,128,14,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_51[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,115,0,97,128,0,128,0,192,0,192,0,192,1,192,3,128,15,0,6,0,3,0,65,128,65,128,35,128,63,0,14,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_52[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,128,1,128,1,128,1,128,127,224,127,224,97,128,33,128,49,128,17,128,25,128,9,128,13,128,5,128,3,128,3,128,1,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_53[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,113,192,96,192,0,96,0,96,0,96,0,96,0,224,1,192,7,192,63,0,60,0,48,0,16,0,16,0,15,192,15,224,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_54[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,61,192,48,192,112,96,96,96,96,96,96,96,96,96,96,192,121,192,119,0,48,0,56,0,24,0,12,0,7,0,1,224,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_55[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,12,0,6,0,6,0,6,0,2,0,3,0,3,0,1,0,1,128,1,128,0,128,0,192,64,192,96,96,127,224,63,224,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_56[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,112,192,96,96,96,96,96,96,32,224,48,192,27,128,15,0,15,0,25,128,48,192,48,192,48,192,25,128,15,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_57[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,14,0,3,0,1,128,1,192,0,192,14,192,57,224,48,224,96,96,96,96,96,96,96,96,96,224,48,192,59,192,15,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_58[] = {6,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_59[] = {7,0,0,0,0,48,24,8,56,48,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_60[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,224,3,128,14,0,56,0,96,0,56,0,14,0,3,128,0,224,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_61[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,248,127,248,0,0,0,0,127,248,127,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_62[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,56,0,14,0,3,128,0,224,0,48,0,224,3,128,14,0,56,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_63[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,12,0,0,0,0,0,4,0,4,0,4,0,6,0,6,0,3,0,3,128,1,192,48,192,48,192,32,192,49,128,31,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_64[] = {22,0,0,0,0,0,0,0,0,0,0,0,0,0,252,0,3,131,0,6,0,0,12,0,0,24,119,128,24,222,192,49,142,96,49,134,32,49,134,48,49,134,16,49,131,16,48,195,16,48,227,16,56,127,16,24,59,48,28,0,32,14,0,96,7,0,192,3,195,128,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_65[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_66[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,240,24,60,24,12,24,6,24,6,24,6,24,12,24,28,31,240,24,32,24,24,24,12,24,12,24,12,24,24,24,56,127,224,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_67[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,15,28,28,4,48,2,48,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,48,2,48,2,28,6,14,30,3,242,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_68[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,224,0,24,56,0,24,28,0,24,6,0,24,6,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,6,0,24,6,0,24,28,0,24,56,0,127,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_69[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,32,24,32,31,224,24,32,24,32,24,0,24,0,24,8,24,8,24,24,127,248,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_70[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,24,0,24,0,24,0,24,0,24,0,24,16,24,16,31,240,24,16,24,16,24,0,24,0,24,8,24,8,24,24,127,248,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_71[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,15,28,0,28,14,0,48,6,0,48,6,0,96,6,0,96,6,0,96,31,128,96,0,0,96,0,0,96,0,0,96,0,0,48,2,0,48,2,0,28,6,0,14,30,0,3,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_72[] = {19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,15,192,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,31,255,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,126,15,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_73[] = {8,0,0,0,0,0,0,0,126,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,126,0,0,0,0,0};
+const unsigned char timesRoman24_74[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,102,0,99,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,15,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_75[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,15,128,24,7,0,24,14,0,24,28,0,24,56,0,24,112,0,24,224,0,25,192,0,31,128,0,31,0,0,25,128,0,24,192,0,24,96,0,24,48,0,24,24,0,24,12,0,126,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_76[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,0,24,0,24,0,24,0,24,0,24,0,24,0,24,0,24,0,24,0,126,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_77[] = {22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,16,252,16,48,48,16,48,48,16,104,48,16,104,48,16,196,48,16,196,48,17,132,48,17,130,48,19,2,48,19,1,48,22,1,48,22,1,48,28,0,176,28,0,176,24,0,112,120,0,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_78[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,6,0,16,14,0,16,14,0,16,26,0,16,50,0,16,50,0,16,98,0,16,194,0,16,194,0,17,130,0,19,2,0,19,2,0,22,2,0,28,2,0,28,2,0,24,2,0,120,15,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_79[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_80[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,24,0,24,0,24,0,24,0,24,0,24,0,24,0,31,224,24,56,24,24,24,12,24,12,24,12,24,24,24,56,127,224,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_81[] = {18,0,0,0,0,0,0,0,7,128,0,28,0,0,56,0,0,112,0,0,224,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_82[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,15,24,14,24,28,24,56,24,48,24,96,24,224,25,192,31,224,24,56,24,24,24,28,24,12,24,28,24,24,24,56,127,224,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_83[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,120,192,96,96,64,48,64,48,0,48,0,112,1,224,7,192,15,0,60,0,112,0,96,32,96,32,96,96,49,224,15,32,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_84[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,224,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,65,130,65,130,97,134,127,254,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_85[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,24,0,12,4,0,24,4,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,126,15,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_86[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,128,0,1,128,0,1,128,0,3,192,0,3,64,0,3,96,0,6,32,0,6,32,0,6,48,0,12,16,0,12,24,0,24,8,0,24,8,0,24,12,0,48,4,0,48,6,0,252,31,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_87[] = {23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,131,0,1,131,0,1,131,128,3,135,128,3,70,128,3,70,192,6,70,64,6,76,64,6,76,96,12,44,96,12,44,32,24,44,32,24,24,48,24,24,16,48,24,16,48,24,24,252,126,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_88[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,15,192,48,3,128,24,7,0,8,14,0,4,12,0,6,24,0,2,56,0,1,112,0,0,224,0,0,192,0,1,192,0,3,160,0,3,16,0,6,8,0,14,12,0,28,6,0,126,15,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_89[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,224,1,128,1,128,1,128,1,128,1,128,1,128,3,192,3,64,6,96,6,32,12,48,28,16,24,24,56,8,48,12,252,63,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_90[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,112,12,56,4,24,4,28,0,12,0,14,0,7,0,3,0,3,128,1,128,1,192,0,224,64,96,64,112,96,56,127,248,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_91[] = {8,0,0,0,62,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,62,0,0,0,0,0};
+const unsigned char timesRoman24_92[] = {7,0,0,0,0,0,0,0,6,6,4,12,12,8,24,24,16,48,48,32,96,96,64,192,192,0,0,0,0,0};
+const unsigned char timesRoman24_93[] = {8,0,0,0,124,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,124,0,0,0,0,0};
+const unsigned char timesRoman24_94[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,64,96,192,32,128,49,128,17,0,27,0,10,0,14,0,4,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_95[] = {13,0,0,0,0,255,248,255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_96[] = {7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,112,64,96,48,0,0,0,0,0};
+const unsigned char timesRoman24_97[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_98[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,57,192,48,192,48,96,48,96,48,96,48,96,48,96,48,96,48,192,57,192,55,0,48,0,48,0,48,0,48,0,112,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_99[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,96,0,96,0,32,192,49,192,15,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_100[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,96,57,192,48,192,96,192,96,192,96,192,96,192,96,192,96,192,48,192,57,192,14,192,0,192,0,192,0,192,0,192,1,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_101[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,127,192,96,192,32,192,49,128,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_102[] = {7,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,254,48,48,48,22,14,0,0,0,0,0};
+const unsigned char timesRoman24_103[] = {12,0,0,0,0,31,128,120,224,96,48,96,16,48,48,31,224,63,128,48,0,24,0,31,0,25,128,48,192,48,192,48,192,48,192,25,128,15,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_104[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,240,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,56,224,55,192,51,128,48,0,48,0,48,0,48,0,112,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_105[] = {6,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,112,0,0,0,48,48,0,0,0,0,0};
+const unsigned char timesRoman24_106[] = {6,0,0,192,224,48,48,48,48,48,48,48,48,48,48,48,48,48,48,112,0,0,0,48,48,0,0,0,0,0};
+const unsigned char timesRoman24_107[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,240,48,224,49,192,51,128,55,0,54,0,60,0,52,0,50,0,51,0,49,128,51,224,48,0,48,0,48,0,48,0,112,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_108[] = {6,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,112,0,0,0,0,0};
+const unsigned char timesRoman24_109[] = {20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,241,224,48,96,192,48,96,192,48,96,192,48,96,192,48,96,192,48,96,192,48,96,192,48,96,192,56,241,192,55,207,128,115,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_110[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,240,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,56,224,55,192,115,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_111[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_112[] = {12,0,0,0,0,120,0,48,0,48,0,48,0,48,0,55,0,57,192,48,192,48,96,48,96,48,96,48,96,48,96,48,96,48,192,57,192,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_113[] = {12,0,0,0,0,1,224,0,192,0,192,0,192,0,192,14,192,57,192,48,192,96,192,96,192,96,192,96,192,96,192,96,192,48,192,57,192,14,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_114[] = {8,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,59,55,115,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_115[] = {10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,99,0,65,128,1,128,3,128,15,0,62,0,56,0,112,0,97,0,51,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_116[] = {7,0,0,0,0,0,0,0,28,50,48,48,48,48,48,48,48,48,48,254,112,48,16,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_117[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,112,31,96,56,224,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_118[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,14,0,14,0,26,0,25,0,25,0,49,0,48,128,48,128,96,128,96,192,241,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_119[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,16,0,14,56,0,14,56,0,26,40,0,26,100,0,25,100,0,49,100,0,48,194,0,48,194,0,96,194,0,96,195,0,241,231,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_120[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,240,48,96,16,192,25,192,13,128,7,0,6,0,13,0,28,128,24,192,48,96,120,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_121[] = {11,0,0,0,0,224,0,240,0,24,0,8,0,12,0,4,0,14,0,14,0,26,0,25,0,25,0,49,0,48,128,48,128,96,128,96,192,241,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_122[] = {10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,128,97,128,48,128,56,0,24,0,28,0,12,0,14,0,7,0,67,0,97,128,127,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_123[] = {10,0,0,0,0,3,128,6,0,12,0,12,0,12,0,12,0,12,0,12,0,8,0,24,0,16,0,96,0,16,0,24,0,8,0,12,0,12,0,12,0,12,0,12,0,6,0,3,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_124[] = {6,0,0,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,0,0,0};
+const unsigned char timesRoman24_125[] = {10,0,0,0,0,112,0,24,0,12,0,12,0,12,0,12,0,12,0,12,0,4,0,6,0,2,0,1,128,2,0,6,0,4,0,12,0,12,0,12,0,12,0,12,0,24,0,112,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_126[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,192,99,224,62,48,28,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_127[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_128[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_129[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_130[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_131[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_132[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_133[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_134[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_135[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_136[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_137[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_138[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_139[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_140[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_141[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_142[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_143[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_144[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_145[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_146[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_147[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_148[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_149[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_150[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_151[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_152[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_153[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_154[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_155[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_156[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_157[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_158[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_159[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_160[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_161[] = {8,0,0,12,12,12,12,12,12,12,12,12,12,12,12,0,0,0,12,12,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_162[] = {12,0,0,0,0,0,0,0,0,0,0,32,0,32,0,31,0,63,128,56,64,104,0,100,0,100,0,100,0,98,0,98,0,33,192,49,192,15,128,0,128,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_163[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,115,192,95,96,60,32,24,0,24,0,24,0,24,0,24,0,24,0,126,0,24,0,24,0,24,0,24,0,24,192,12,192,7,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_164[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,48,119,112,63,224,24,192,48,96,48,96,48,96,48,96,24,192,63,224,119,112,96,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_165[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,192,3,0,3,0,3,0,3,0,31,224,3,0,31,224,3,0,7,128,12,128,12,192,24,64,24,96,48,32,112,48,248,124,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_166[] = {6,0,0,0,0,0,0,0,48,48,48,48,48,48,48,0,0,0,48,48,48,48,48,48,48,0,0,0,0,0};
+const unsigned char timesRoman24_167[] = {12,0,0,0,0,0,0,0,0,0,0,14,0,25,0,24,128,1,128,3,128,7,0,14,0,29,0,56,128,48,192,32,192,33,192,19,128,15,0,14,0,28,0,24,0,17,128,9,128,7,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_168[] = {8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,102,0,0,0,0,0,0};
+const unsigned char timesRoman24_169[] = {19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,248,0,14,14,0,24,3,0,48,225,128,35,184,128,98,12,192,70,0,64,68,0,64,68,0,64,68,0,64,70,0,64,98,12,192,35,152,128,48,241,128,24,3,0,14,14,0,3,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_170[] = {8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,118,204,204,124,12,204,120,0,0,0,0,0};
+const unsigned char timesRoman24_171[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,32,6,96,12,192,25,128,51,0,51,0,25,128,12,192,6,96,2,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_172[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,24,0,24,0,24,0,24,127,248,127,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_173[] = {9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_174[] = {19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,248,0,14,14,0,24,3,0,48,1,128,35,140,128,97,24,192,65,16,64,65,32,64,65,240,64,65,24,64,65,8,64,97,8,192,33,24,128,51,241,128,24,3,0,14,14,0,3,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_175[] = {8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,126,0,0,0,0,0,0};
+const unsigned char timesRoman24_176[] = {9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,34,0,65,0,65,0,65,0,34,0,28,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_177[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,248,127,248,0,0,3,0,3,0,3,0,3,0,3,0,127,248,127,248,3,0,3,0,3,0,3,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_178[] = {7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,68,32,48,16,8,12,140,76,56,0,0,0,0,0};
+const unsigned char timesRoman24_179[] = {7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,136,140,12,8,48,8,140,76,56,0,0,0,0,0};
+const unsigned char timesRoman24_180[] = {8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,24,14,6,0,0,0,0,0};
+const unsigned char timesRoman24_181[] = {13,0,0,0,0,32,0,112,0,96,0,32,0,32,0,46,112,63,96,56,224,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_182[] = {11,0,0,0,0,4,128,4,128,4,128,4,128,4,128,4,128,4,128,4,128,4,128,4,128,4,128,12,128,28,128,60,128,60,128,124,128,124,128,124,128,60,128,60,128,28,128,15,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_183[] = {6,0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_184[] = {8,0,60,102,6,30,24,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_185[] = {7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,16,16,16,16,16,16,80,48,16,0,0,0,0,0};
+const unsigned char timesRoman24_186[] = {8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,60,102,102,102,102,102,60,0,0,0,0,0};
+const unsigned char timesRoman24_187[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,51,0,25,128,12,192,6,96,6,96,12,192,25,128,51,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_188[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,2,0,8,2,0,12,127,128,4,34,0,6,50,0,3,18,0,1,10,0,125,142,0,16,134,0,16,194,0,16,96,0,16,32,0,16,48,0,16,16,0,80,24,0,48,12,0,16,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_189[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,63,0,8,17,0,12,8,0,4,12,0,6,4,0,3,2,0,1,3,0,125,163,0,16,147,0,16,206,0,16,96,0,16,32,0,16,48,0,16,16,0,80,24,0,48,12,0,16,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_190[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,2,0,8,2,0,12,127,128,4,34,0,6,50,0,3,18,0,1,10,0,113,142,0,136,134,0,140,194,0,12,96,0,8,32,0,48,48,0,8,16,0,140,24,0,76,12,0,56,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_191[] = {11,0,0,0,0,31,0,49,128,96,128,97,128,97,128,112,0,56,0,24,0,28,0,12,0,12,0,4,0,4,0,0,0,0,0,6,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_192[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,0,32,0,0,192,0,3,128,0,3,0,0};
+const unsigned char timesRoman24_193[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,1,0,0,0,192,0,0,112,0,0,48,0};
+const unsigned char timesRoman24_194[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,8,16,0,6,96,0,3,192,0,1,128,0};
+const unsigned char timesRoman24_195[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,7,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,0,0,0,4,224,0,3,144,0,0,0,0};
+const unsigned char timesRoman24_196[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,0,0,0,6,48,0,6,48,0,0,0,0};
+const unsigned char timesRoman24_197[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,1,192,0,2,32,0,2,32,0,1,192,0,0,0,0};
+const unsigned char timesRoman24_198[] = {21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,255,240,48,96,48,16,96,16,16,96,16,24,96,0,8,96,0,15,224,128,12,96,128,4,127,128,4,96,128,6,96,128,2,96,0,2,96,0,1,96,32,1,96,32,1,224,96,3,255,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_199[] = {16,0,0,3,192,6,96,0,96,1,224,1,128,0,128,3,240,15,28,28,4,48,2,48,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,48,2,48,2,28,6,14,30,3,242,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_200[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,32,24,32,31,224,24,32,24,32,24,0,24,0,24,8,24,8,24,24,127,248,0,0,0,128,3,0,14,0,12,0};
+const unsigned char timesRoman24_201[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,32,24,32,31,224,24,32,24,32,24,0,24,0,24,8,24,8,24,24,127,248,0,0,2,0,1,128,0,224,0,96};
+const unsigned char timesRoman24_202[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,32,24,32,31,224,24,32,24,32,24,0,24,0,24,8,24,8,24,24,127,248,0,0,8,16,6,96,3,192,1,128};
+const unsigned char timesRoman24_203[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,32,24,32,31,224,24,32,24,32,24,0,24,0,24,8,24,8,24,24,127,248,0,0,0,0,12,192,12,192,0,0};
+const unsigned char timesRoman24_204[] = {8,0,0,0,0,0,0,0,126,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,126,0,4,24,112,96};
+const unsigned char timesRoman24_205[] = {8,0,0,0,0,0,0,0,126,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,126,0,32,24,14,6};
+const unsigned char timesRoman24_206[] = {8,0,0,0,0,0,0,0,63,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,63,0,64,51,30,12};
+const unsigned char timesRoman24_207[] = {8,0,0,0,0,0,0,0,126,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,126,0,0,102,102,0};
+const unsigned char timesRoman24_208[] = {17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,224,0,24,56,0,24,28,0,24,6,0,24,6,0,24,3,0,24,3,0,24,3,0,255,3,0,24,3,0,24,3,0,24,3,0,24,6,0,24,6,0,24,28,0,24,56,0,127,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_209[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,6,0,16,14,0,16,14,0,16,26,0,16,50,0,16,50,0,16,98,0,16,194,0,16,194,0,17,130,0,19,2,0,19,2,0,22,2,0,28,2,0,28,2,0,24,2,0,120,15,128,0,0,0,0,0,0,2,112,0,1,200,0,0,0,0};
+const unsigned char timesRoman24_210[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,32,0,0,192,0,3,128,0,3,0,0};
+const unsigned char timesRoman24_211[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,128,0,0,96,0,0,56,0,0,24,0};
+const unsigned char timesRoman24_212[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,4,8,0,3,48,0,1,224,0,0,192,0};
+const unsigned char timesRoman24_213[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,0,0,2,112,0,1,200,0,0,0,0};
+const unsigned char timesRoman24_214[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,0,0,3,48,0,3,48,0,0,0,0};
+const unsigned char timesRoman24_215[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,16,48,48,24,96,12,192,7,128,3,0,7,128,12,192,24,96,48,48,32,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_216[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,19,240,0,14,28,0,28,14,0,52,3,0,50,3,0,97,1,128,97,1,128,96,129,128,96,129,128,96,65,128,96,65,128,96,33,128,48,35,0,48,19,0,28,14,0,14,28,0,3,242,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_217[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,24,0,12,4,0,24,4,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,126,15,128,0,0,0,0,32,0,0,192,0,3,128,0,3,0,0};
+const unsigned char timesRoman24_218[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,24,0,12,4,0,24,4,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,126,15,128,0,0,0,0,128,0,0,96,0,0,56,0,0,24,0};
+const unsigned char timesRoman24_219[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,24,0,12,4,0,24,4,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,126,15,128,0,0,0,4,8,0,3,48,0,1,224,0,0,192,0};
+const unsigned char timesRoman24_220[] = {18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,14,24,0,12,4,0,24,4,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,126,15,128,0,0,0,0,0,0,3,24,0,3,24,0,0,0,0};
+const unsigned char timesRoman24_221[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,224,1,128,1,128,1,128,1,128,1,128,1,128,3,192,3,64,6,96,6,32,12,48,28,16,24,24,56,8,48,12,252,63,0,0,1,0,0,192,0,112,0,48};
+const unsigned char timesRoman24_222[] = {15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,24,0,24,0,24,0,31,224,24,56,24,24,24,12,24,12,24,12,24,24,24,56,31,224,24,0,24,0,24,0,126,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_223[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,115,128,54,64,54,96,48,96,48,96,48,224,48,192,49,192,51,128,54,0,49,128,48,192,48,192,48,192,48,192,25,128,15,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_224[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,2,0,12,0,56,0,48,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_225[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,8,0,6,0,3,128,1,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_226[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,33,0,18,0,30,0,12,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_227[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,0,0,46,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_228[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,0,0,51,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_229[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,14,0,17,0,17,0,14,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_230[] = {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,120,125,252,99,194,97,128,97,128,49,128,29,128,7,254,1,134,49,134,51,204,30,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_231[] = {11,0,0,30,0,51,0,3,0,15,0,12,0,4,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,96,0,96,0,32,192,49,192,15,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_232[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,127,192,96,192,32,192,49,128,15,0,0,0,2,0,12,0,56,0,48,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_233[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,127,192,96,192,32,192,49,128,15,0,0,0,8,0,6,0,3,128,1,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_234[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,127,192,96,192,32,192,49,128,15,0,0,0,16,128,9,0,15,0,6,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_235[] = {11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,0,127,192,96,192,32,192,49,128,15,0,0,0,0,0,25,128,25,128,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_236[] = {6,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,112,0,8,48,224,192,0,0,0,0,0};
+const unsigned char timesRoman24_237[] = {6,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,112,0,64,48,28,12,0,0,0,0,0};
+const unsigned char timesRoman24_238[] = {6,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,112,0,132,72,120,48,0,0,0,0,0};
+const unsigned char timesRoman24_239[] = {6,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,48,48,112,0,0,204,204,0,0,0,0,0,0};
+const unsigned char timesRoman24_240[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,128,99,0,30,0,15,0,56,192,96,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_241[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,240,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,56,224,55,192,115,128,0,0,0,0,19,128,14,64,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_242[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,0,0,0,1,0,6,0,28,0,24,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_243[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,0,0,0,4,0,3,0,1,192,0,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_244[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,0,0,0,16,128,9,0,15,0,6,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_245[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,0,0,0,0,0,19,128,14,64,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_246[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,96,96,96,96,48,192,57,192,15,0,0,0,0,0,25,128,25,128,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_247[] = {14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,3,0,0,0,0,0,127,248,127,248,0,0,0,0,3,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_248[] = {12,0,0,0,0,0,0,0,0,0,0,0,0,96,0,111,0,57,192,56,192,104,96,108,96,100,96,102,96,98,96,99,96,49,192,57,192,15,96,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_249[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,112,31,96,56,224,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,1,0,6,0,28,0,24,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_250[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,112,31,96,56,224,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,4,0,3,0,1,192,0,192,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_251[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,112,31,96,56,224,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,16,128,9,0,15,0,6,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_252[] = {13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,112,31,96,56,224,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,0,0,25,128,25,128,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_253[] = {11,0,0,0,0,224,0,240,0,24,0,8,0,12,0,4,0,14,0,14,0,26,0,25,0,25,0,49,0,48,128,48,128,96,128,96,192,241,224,0,0,8,0,6,0,3,128,1,128,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_254[] = {12,0,0,0,0,120,0,48,0,48,0,48,0,48,0,55,0,57,192,48,192,48,96,48,96,48,96,48,96,48,96,48,96,48,192,57,192,55,0,48,0,48,0,48,0,48,0,112,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char timesRoman24_255[] = {11,0,0,0,0,224,0,240,0,24,0,8,0,12,0,4,0,14,0,14,0,26,0,25,0,25,0,49,0,48,128,48,128,96,128,96,192,241,224,0,0,0,0,51,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const unsigned char *const timesRoman24Glyphs[] = {timesRoman24_0,timesRoman24_1,timesRoman24_2,timesRoman24_3,timesRoman24_4,timesRoman24_5,timesRoman24_6,timesRoman24_7,timesRoman24_8,timesRoman24_9,timesRoman24_10,timesRoman24_11,timesRoman24_12,timesRoman24_13,timesRoman24_14,timesRoman24_15,timesRoman24_16,timesRoman24_17,timesRoman24_18,timesRoman24_19,timesRoman24_20,timesRoman24_21,timesRoman24_22,timesRoman24_23,timesRoman24_24,timesRoman24_25,timesRoman24_26,timesRoman24_27,timesRoman24_28,timesRoman24_29,timesRoman24_30,timesRoman24_31,timesRoman24_32,timesRoman24_33,timesRoman24_34,timesRoman24_35,timesRoman24_36,timesRoman24_37,timesRoman24_38,timesRoman24_39,timesRoman24_40,timesRoman24_41,timesRoman24_42,timesRoman24_43,timesRoman24_44,timesRoman24_45,timesRoman24_46,timesRoman24_47,timesRoman24_48,timesRoman24_49,timesRoman24_50,timesRoman24_51,timesRoman24_52,timesRoman24_53,timesRoman24_54,timesRoman24_55,timesRoman24_56,timesRoman24_57,timesRoman24_58,timesRoman24_59,timesRoman24_60,timesRoman24_61,timesRoman24_62,timesRoman24_63,timesRoman24_64,timesRoman24_65,timesRoman24_66,timesRoman24_67,timesRoman24_68,timesRoman24_69,timesRoman24_70,timesRoman24_71,timesRoman24_72,timesRoman24_73,timesRoman24_74,timesRoman24_75,timesRoman24_76,timesRoman24_77,timesRoman24_78,timesRoman24_79,timesRoman24_80,timesRoman24_81,timesRoman24_82,timesRoman24_83,timesRoman24_84,timesRoman24_85,timesRoman24_86,timesRoman24_87,timesRoman24_88,timesRoman24_89,timesRoman24_90,timesRoman24_91,timesRoman24_92,timesRoman24_93,timesRoman24_94,timesRoman24_95,timesRoman24_96,timesRoman24_97,timesRoman24_98,timesRoman24_99,timesRoman24_100,timesRoman24_101,timesRoman24_102,timesRoman24_103,timesRoman24_104,timesRoman24_105,timesRoman24_106,timesRoman24_107,timesRoman24_108,timesRoman24_109,timesRoman24_110,timesRoman24_111,timesRoman24_112,timesRoman24_113,timesRoman24_114,timesRoman24_115,timesRoman24_116,timesRoman24_117,timesRoman24_118,timesRoman24_119,timesRoman24_120,timesRoman24_121,timesRoman24_122,timesRoman24_123,timesRoman24_124,timesRoman24_125,timesRoman24_126,timesRoman24_127,timesRoman24_128,timesRoman24_129,timesRoman24_130,timesRoman24_131,timesRoman24_132,timesRoman24_133,timesRoman24_134,timesRoman24_135,timesRoman24_136,timesRoman24_137,timesRoman24_138,timesRoman24_139,timesRoman24_140,timesRoman24_141,timesRoman24_142,timesRoman24_143,timesRoman24_144,timesRoman24_145,timesRoman24_146,timesRoman24_147,timesRoman24_148,timesRoman24_149,timesRoman24_150,timesRoman24_151,timesRoman24_152,timesRoman24_153,timesRoman24_154,timesRoman24_155,timesRoman24_156,timesRoman24_157,timesRoman24_158,timesRoman24_159,timesRoman24_160,timesRoman24_161,timesRoman24_162,timesRoman24_163,timesRoman24_164,timesRoman24_165,timesRoman24_166,timesRoman24_167,timesRoman24_168,timesRoman24_169,timesRoman24_170,timesRoman24_171,timesRoman24_172,timesRoman24_173,timesRoman24_174,timesRoman24_175,timesRoman24_176,timesRoman24_177,timesRoman24_178,timesRoman24_179,timesRoman24_180,timesRoman24_181,timesRoman24_182,timesRoman24_183,timesRoman24_184,timesRoman24_185,timesRoman24_186,timesRoman24_187,timesRoman24_188,timesRoman24_189,timesRoman24_190,timesRoman24_191,timesRoman24_192,timesRoman24_193,timesRoman24_194,timesRoman24_195,timesRoman24_196,timesRoman24_197,timesRoman24_198,timesRoman24_199,timesRoman24_200,timesRoman24_201,timesRoman24_202,timesRoman24_203,timesRoman24_204,timesRoman24_205,timesRoman24_206,timesRoman24_207,timesRoman24_208,timesRoman24_209,timesRoman24_210,timesRoman24_211,timesRoman24_212,timesRoman24_213,timesRoman24_214,timesRoman24_215,timesRoman24_216,timesRoman24_217,timesRoman24_218,timesRoman24_219,timesRoman24_220,timesRoman24_221,timesRoman24_222,timesRoman24_223,timesRoman24_224,timesRoman24_225,timesRoman24_226,timesRoman24_227,timesRoman24_228,timesRoman24_229,timesRoman24_230,timesRoman24_231,timesRoman24_232,timesRoman24_233,timesRoman24_234,timesRoman24_235,timesRoman24_236,timesRoman24_237,timesRoman24_238,timesRoman24_239,timesRoman24_240,timesRoman24_241,timesRoman24_242,timesRoman24_243,timesRoman24_244,timesRoman24_245,timesRoman24_246,timesRoman24_247,timesRoman24_248,timesRoman24_249,timesRoman24_250,timesRoman24_251,timesRoman24_252,timesRoman24_253,timesRoman24_254,timesRoman24_255};
+
+} // namespace
+
+#endif
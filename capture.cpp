@@ -0,0 +1,335 @@
+#include "capture.h"
+
+#include "engine.h"
+#include "render_backend.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+bool WritePPM(const char *path, int width, int height,
+              const unsigned char *rgba) {
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    printf("Failed to write frame: %s\n", path);
+    return false;
+  }
+  fprintf(file, "P6\n%d %d\n255\n", width, height);
+  std::vector<unsigned char> row(width * 3);
+  for (int y = height - 1; y >= 0; y--) { // PPM is top row first
+    const unsigned char *src = rgba + y * width * 4;
+    for (int x = 0; x < width; x++) {
+      row[x * 3 + 0] = src[x * 4 + 0];
+      row[x * 3 + 1] = src[x * 4 + 1];
+      row[x * 3 + 2] = src[x * 4 + 2];
+    }
+    fwrite(row.data(), 1, row.size(), file);
+  }
+  fclose(file);
+  return true;
+}
+
+namespace {
+
+// ============================================================================
+// Encoders
+// ============================================================================
+
+void PutBigEndian(std::vector<unsigned char> &out, uint32_t value) {
+  out.push_back(value >> 24);
+  out.push_back(value >> 16);
+  out.push_back(value >> 8);
+  out.push_back(value);
+}
+
+void PutChunk(std::vector<unsigned char> &out, const char *type,
+              const unsigned char *data, uint32_t length) {
+  PutBigEndian(out, length);
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data, data + length);
+  PutBigEndian(out, crc32(0, out.data() + start, length + 4));
+}
+
+// RGB PNG with the Sub filter: flat fills become runs of zeros, which
+// zlib's run-length strategy squeezes nearly as well as full deflate at a
+// fraction of the cost
+void EncodePNG(const std::vector<unsigned char> &rgba, int width, int height,
+               std::vector<unsigned char> &rows,
+               std::vector<unsigned char> &compressed,
+               std::vector<unsigned char> &out) {
+  int stride = 1 + width * 3;
+  rows.resize((size_t)stride * height);
+  for (int y = 0; y < height; y++) {
+    const unsigned char *src = &rgba[(size_t)(height - 1 - y) * width * 4];
+    unsigned char *dst = &rows[(size_t)y * stride];
+    *dst++ = 1; // Sub
+    unsigned char left[3] = {0, 0, 0};
+    for (int x = 0; x < width; x++, src += 4, dst += 3) {
+      for (int c = 0; c < 3; c++) {
+        dst[c] = src[c] - left[c];
+        left[c] = src[c];
+      }
+    }
+  }
+
+  z_stream stream = {};
+  deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 15, 8, Z_RLE);
+  compressed.resize(deflateBound(&stream, rows.size()));
+  stream.next_in = rows.data();
+  stream.avail_in = rows.size();
+  stream.next_out = compressed.data();
+  stream.avail_out = compressed.size();
+  deflate(&stream, Z_FINISH);
+  uint32_t compressedSize = stream.total_out;
+  deflateEnd(&stream);
+
+  static const unsigned char signature[] = {0x89, 'P', 'N',  'G',
+                                            '\r', '\n', 0x1a, '\n'};
+  unsigned char header[13] = {};
+  for (int i = 0; i < 4; i++) {
+    header[i] = width >> (24 - i * 8);
+    header[4 + i] = height >> (24 - i * 8);
+  }
+  header[8] = 8; // bits per channel
+  header[9] = 2; // RGB
+
+  out.assign(signature, signature + sizeof(signature));
+  PutChunk(out, "IHDR", header, sizeof(header));
+  PutChunk(out, "IDAT", compressed.data(), compressedSize);
+  PutChunk(out, "IEND", nullptr, 0);
+}
+
+// Full-range BT.601 (what C420jpeg means), chroma averaged over 2x2 blocks
+void ConvertToYUV420(const std::vector<unsigned char> &rgba, int width,
+                     int height, std::vector<unsigned char> &yuv) {
+  int chromaWidth = width / 2, chromaHeight = height / 2;
+  yuv.resize((size_t)width * height + 2 * chromaWidth * chromaHeight);
+  unsigned char *luma = yuv.data();
+  unsigned char *cb = luma + width * height;
+  unsigned char *cr = cb + chromaWidth * chromaHeight;
+
+  for (int y = 0; y < height; y++) {
+    const unsigned char *src = &rgba[(size_t)(height - 1 - y) * width * 4];
+    unsigned char *dst = luma + (size_t)y * width;
+    for (int x = 0; x < width; x++, src += 4)
+      dst[x] = (77 * src[0] + 150 * src[1] + 29 * src[2] + 128) >> 8;
+  }
+  for (int y = 0; y < chromaHeight; y++) {
+    const unsigned char *top =
+        &rgba[(size_t)(height - 1 - y * 2) * width * 4];
+    const unsigned char *bottom = top - width * 4;
+    for (int x = 0; x < chromaWidth; x++, top += 8, bottom += 8) {
+      int r = top[0] + top[4] + bottom[0] + bottom[4];
+      int g = top[1] + top[5] + bottom[1] + bottom[5];
+      int b = top[2] + top[6] + bottom[2] + bottom[6];
+      // Coefficients are scaled by 256 and the sums by 4; the 128 offset is
+      // folded in first so the shift never sees a negative value
+      int u = (-43 * r - 85 * g + 128 * b + (128 << 10) + 512) >> 10;
+      int v = (128 * r - 107 * g - 21 * b + (128 << 10) + 512) >> 10;
+      cb[y * chromaWidth + x] = std::min(u, 255);
+      cr[y * chromaWidth + x] = std::min(v, 255);
+    }
+  }
+}
+
+// ============================================================================
+// Recorder
+// ============================================================================
+
+// Frames waiting for an encoder; when it is full the main thread blocks
+// rather than dropping frames from the recording
+const int kMaxQueuedFrames = 8;
+
+struct Frame {
+  int index;
+  std::vector<unsigned char> rgba;
+};
+
+struct Recorder {
+  std::string path;
+  bool video;
+  int width, height;
+  FILE *file = nullptr; // the Y4M stream
+  std::vector<std::thread> encoders;
+
+  std::mutex mutex;
+  std::condition_variable queued, dequeued, written;
+  std::deque<Frame> queue;
+  std::vector<std::vector<unsigned char>> spare; // recycled frame buffers
+  int nextWrite = 0; // Y4M frames go out in capture order
+  int failures = 0;
+  bool stopping = false;
+
+  // Main thread only
+  std::vector<unsigned char> readback;
+  int captured = 0, stalls = 0;
+  double totalMs = 0, worstMs = 0;
+};
+
+Recorder *recorder = nullptr;
+
+// Per-encoder scratch, kept between frames
+struct EncodeBuffers {
+  std::vector<unsigned char> rows, compressed, out;
+};
+
+void Encode(Recorder &r, const Frame &frame, EncodeBuffers &buffers) {
+  std::vector<unsigned char> &out = buffers.out;
+  if (!r.video) {
+    EncodePNG(frame.rgba, r.width, r.height, buffers.rows, buffers.compressed,
+              out);
+    char name[32];
+    snprintf(name, sizeof(name), "/frame_%05d.png", frame.index);
+    std::string path = r.path + name;
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file || fwrite(out.data(), 1, out.size(), file) != out.size()) {
+      std::lock_guard<std::mutex> lock(r.mutex);
+      r.failures++;
+    }
+    if (file)
+      fclose(file);
+    return;
+  }
+
+  // Conversion runs in parallel; the writes take turns by frame index.
+  // Encoders pop frames in order, so the frame being waited for is always
+  // already with another encoder.
+  ConvertToYUV420(frame.rgba, r.width, r.height, out);
+  std::unique_lock<std::mutex> lock(r.mutex);
+  r.written.wait(lock, [&] { return r.nextWrite == frame.index; });
+  lock.unlock();
+  bool ok = fputs("FRAME\n", r.file) >= 0 &&
+            fwrite(out.data(), 1, out.size(), r.file) == out.size();
+  lock.lock();
+  if (!ok)
+    r.failures++;
+  r.nextWrite++;
+  r.written.notify_all();
+}
+
+void EncodeLoop(Recorder &r) {
+  EncodeBuffers buffers;
+  for (;;) {
+    Frame frame;
+    {
+      std::unique_lock<std::mutex> lock(r.mutex);
+      r.queued.wait(lock, [&] { return r.stopping || !r.queue.empty(); });
+      if (r.queue.empty())
+        return;
+      frame = std::move(r.queue.front());
+      r.queue.pop_front();
+    }
+    r.dequeued.notify_one();
+
+    Encode(r, frame, buffers);
+
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.spare.push_back(std::move(frame.rgba));
+  }
+}
+
+// Hands the readback buffer to the encoders and swaps in a spare one
+void Submit(Recorder &r) {
+  {
+    std::unique_lock<std::mutex> lock(r.mutex);
+    if ((int)r.queue.size() >= kMaxQueuedFrames) {
+      r.stalls++;
+      r.dequeued.wait(
+          lock, [&] { return (int)r.queue.size() < kMaxQueuedFrames; });
+    }
+    r.queue.push_back({r.captured++, std::move(r.readback)});
+    r.readback.clear();
+    if (!r.spare.empty()) {
+      r.readback = std::move(r.spare.back());
+      r.spare.pop_back();
+    }
+  }
+  r.queued.notify_one();
+}
+
+} // namespace
+
+bool StartCapture(const char *path, int width, int height) {
+  StopCapture();
+  Recorder *r = new Recorder();
+  r->path = path;
+  r->width = width;
+  r->height = height;
+  size_t length = r->path.size();
+  r->video = length > 4 && r->path.compare(length - 4, 4, ".y4m") == 0;
+
+  if (r->video) {
+    r->file = fopen(path, "wb");
+    if (!r->file) {
+      printf("Cannot open capture file: %s\n", path);
+      delete r;
+      return false;
+    }
+    // One frame per display tick
+    fprintf(r->file, "YUV4MPEG2 W%d H%d F1000:%d Ip A1:1 C420jpeg\n", width,
+            height, (int)(kTickSeconds * 1000 + 0.5f));
+  }
+
+  unsigned cores = std::thread::hardware_concurrency();
+  int encoders = std::max(1, std::min(4, (int)cores - 1));
+  for (int i = 0; i < encoders; i++)
+    r->encoders.emplace_back(EncodeLoop, std::ref(*r));
+  recorder = r;
+  printf("Capturing to %s with %d encoder thread%s\n", path, encoders,
+         encoders == 1 ? "" : "s");
+  return true;
+}
+
+void CaptureFrame() {
+  if (!recorder)
+    return;
+  Recorder &r = *recorder;
+  auto start = std::chrono::steady_clock::now();
+
+  RenderBackend *renderer = Renderer();
+  while (renderer->TakeReadback(r.readback, false))
+    Submit(r);
+  renderer->QueueReadback();
+
+  double ms = std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+  r.totalMs += ms;
+  r.worstMs = std::max(r.worstMs, ms);
+}
+
+void StopCapture() {
+  if (!recorder)
+    return;
+  Recorder &r = *recorder;
+  while (Renderer()->TakeReadback(r.readback, true))
+    Submit(r);
+  {
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.stopping = true;
+  }
+  r.queued.notify_all();
+  for (std::thread &encoder : r.encoders)
+    encoder.join();
+  if (r.file)
+    fclose(r.file);
+
+  int frames = std::max(1, r.captured);
+  printf("Captured %d frames to %s: %.3f ms/frame on the main thread "
+         "(worst %.3f), %d stalls on a full queue\n",
+         r.captured, r.path.c_str(), r.totalMs / frames, r.worstMs, r.stalls);
+  if (r.failures)
+    printf("Failed to write %d captured frames\n", r.failures);
+  delete recorder;
+  recorder = nullptr;
+}
@@ -0,0 +1,21 @@
+// Frame grabs for headless QA renders, and recording of the running game
+// to a PNG sequence or raw Y4M video
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+// Writes a bottom-up RGBA frame as a binary PPM
+bool WritePPM(const char *path, int width, int height,
+              const unsigned char *rgba);
+
+// Records every rendered frame until StopCapture. A path ending in ".y4m"
+// is written as one YUV 4:2:0 video stream; anything else is a directory
+// that receives frame_00000.png, frame_00001.png, ... Frames are read back
+// asynchronously through the renderer and encoded on their own threads, so
+// the main thread only pays for the copy out of the readback.
+bool StartCapture(const char *path, int width, int height);
+// Call once per frame, after EndFrame and before the buffer swap
+void CaptureFrame();
+// Drains the readbacks and the encoders, then prints the capture stats
+void StopCapture();
+
+#endif
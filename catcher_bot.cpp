@@ -0,0 +1,148 @@
+#include "catcher_bot.h"
+
+#include "batch_env.h"
+#include "engine.h"
+#include "game_rules.h"
+#include "job_system.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+// Basket positions are planned kCell pixels apart, and a plan step is the
+// time the basket takes to move one cell
+const float kCell = 20.0f;
+const int kCells = (int)((WINDOW_WIDTH - BASKET_WIDTH) / kCell) + 1;
+const float kStep = kCell / BASKET_SPEED;
+const int kMaxSteps = 45; // three seconds ahead
+
+// A lost life costs more than a catch earns, since three end the game
+const float kCatch = 1.0f;
+const float kHurt = -4.0f;
+// Pixels the basket keeps clear of a catch's edges and of bad items, to
+// cover plan steps not lining up with ticks
+const float kMargin = 10.0f;
+// Among equally good paths, the one ending nearer the middle wins
+const float kCenterPull = 0.001f;
+
+const int kPlanGrain = 64;
+
+// Items enter the basket's rows once their bottom is below its top, and
+// leave once their top is below its bottom
+const float kTop = BASKET_Y + BASKET_HEIGHT;
+const float kBottom = BASKET_Y - ITEM_SIZE;
+
+// out[c] = row[c] + the best of next[c - 1 .. c + 1]; next and out are
+// padded by a cell either side
+void StepBack(const float *row, const float *next, float *out) {
+  int c = 1;
+#ifdef __SSE2__
+  for (; c + 4 <= kCells + 1; c += 4) {
+    __m128 best = _mm_max_ps(_mm_loadu_ps(next + c),
+                             _mm_max_ps(_mm_loadu_ps(next + c - 1),
+                                        _mm_loadu_ps(next + c + 1)));
+    _mm_storeu_ps(out + c, _mm_add_ps(_mm_loadu_ps(row + c - 1), best));
+  }
+#endif
+  for (; c <= kCells; c++)
+    out[c] = row[c - 1] + std::max(next[c], std::max(next[c - 1], next[c + 1]));
+}
+
+// Adds value to cells [first, last] of row
+void AddToCells(float *row, float first, float last, float value) {
+  int c0 = std::max(0, (int)std::ceil(first / kCell));
+  int c1 = std::min(kCells - 1, (int)std::floor(last / kCell));
+  for (int c = c0; c <= c1; c++)
+    row[c] += value;
+}
+
+} // namespace
+
+int PlanBasketMove(float basketX, const BotItem *items, int count) {
+  // reward[s][c]: what being at cell c at step s scores
+  float reward[kMaxSteps][kCells];
+  int steps = 1;
+  for (int i = 0; i < count; i++) {
+    const BotItem &item = items[i];
+    if (item.speed <= 0)
+      continue;
+    float enter = (item.y - kTop) / item.speed;
+    float leave = (item.y - kBottom) / item.speed;
+    if (leave < 0 || enter >= (kMaxSteps - 1) * kStep)
+      continue;
+    steps = std::max(steps, std::min(kMaxSteps, (int)(leave / kStep) + 2));
+  }
+  memset(reward, 0, sizeof(float) * kCells * steps);
+
+  // The basket catches an item when its left edge is within
+  // (x - BASKET_WIDTH, x + ITEM_SIZE) while the item is in its rows
+  for (int i = 0; i < count; i++) {
+    const BotItem &item = items[i];
+    if (item.speed <= 0)
+      continue;
+    float enter = (item.y - kTop) / item.speed;
+    float leave = (item.y - kBottom) / item.speed;
+    if (leave < 0)
+      continue;
+    float left = item.x - BASKET_WIDTH, right = item.x + ITEM_SIZE;
+    if (item.kind > 0) {
+      // Counted once, at the step the item reaches the basket
+      int s = std::max(1, (int)std::lround(enter / kStep));
+      if (s < steps && s * kStep <= leave + kStep)
+        AddToCells(reward[s], left + kMargin, right - kMargin, kCatch);
+    } else {
+      int s0 = std::max(1, (int)std::floor(enter / kStep));
+      int s1 = std::min(steps - 1, (int)std::ceil(leave / kStep));
+      for (int s = s0; s <= s1; s++)
+        AddToCells(reward[s], left - kMargin, right + kMargin, kHurt);
+    }
+  }
+
+  // Best total from each cell onwards, a step at a time back to step 1;
+  // the basket moves at most one cell per step
+  const float center = (kCells - 1) / 2.0f;
+  float buffers[2][kCells + 2];
+  float *next = buffers[0], *value = buffers[1];
+  next[0] = next[kCells + 1] = value[0] = value[kCells + 1] = -1e30f;
+  for (int c = 0; c < kCells; c++)
+    next[c + 1] = -kCenterPull * std::fabs(c - center);
+  for (int s = steps - 1; s >= 1; s--) {
+    StepBack(reward[s], next, value);
+    std::swap(next, value);
+  }
+
+  // Staying wins ties, so the basket doesn't wander
+  int here = std::min(kCells - 1, (int)std::lround(basketX / kCell));
+  int best = here;
+  for (int c = std::max(0, here - 1); c <= std::min(kCells - 1, here + 1); c++)
+    if (next[c + 1] > next[best + 1])
+      best = c;
+
+  // Hold still once within half a tick's travel of the target
+  float error = best * kCell - basketX;
+  if (std::fabs(error) <= BASKET_SPEED * kTickSeconds / 2)
+    return 0;
+  return error < 0 ? -1 : 1;
+}
+
+void PlanBatchMoves(const BatchEnv &env, int8_t *actions) {
+  ParallelFor(env.Count(), kPlanGrain, [&](int begin, int end) {
+    BotItem items[BatchEnv::kItemSlots];
+    for (int i = begin; i < end; i++) {
+      int count = 0;
+      for (int s = 0; s < BatchEnv::kItemSlots; s++) {
+        float kind = env.ItemKind(i, s);
+        if (kind != 0)
+          items[count++] = {env.ItemX(i, s), env.ItemY(i, s),
+                            env.ItemSpeed(i, s), kind};
+      }
+      actions[i] = (int8_t)PlanBasketMove(env.BasketX(i), items, count);
+    }
+  });
+}
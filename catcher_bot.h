@@ -0,0 +1,27 @@
+// A Season Catcher player for soak tests and bot baselines. Each tick it
+// plans the basket's path over the next few seconds on a grid of basket
+// positions and time steps, scoring a catch for every good item the path is
+// under as the item reaches the basket and a penalty for every bad one it
+// touches, and returns the first move of the best path. Planning is a few
+// thousand adds with no state kept between ticks, so any number of games
+// can be planned in parallel.
+#ifndef CATCHER_BOT_H
+#define CATCHER_BOT_H
+
+#include <cstdint>
+
+class BatchEnv;
+
+struct BotItem {
+  float x, y;  // bottom left corner
+  float speed; // pixels per second, downwards
+  float kind;  // 1 good, -1 bad
+};
+
+// The arrow to hold this tick: -1 left, 1 right, 0 neither
+int PlanBasketMove(float basketX, const BotItem *items, int count);
+
+// Plans every game of env into actions, split across the job system
+void PlanBatchMoves(const BatchEnv &env, int8_t *actions);
+
+#endif
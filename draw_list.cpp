@@ -0,0 +1,77 @@
+#include "draw_list.h"
+
+#include <algorithm>
+
+namespace {
+
+// Draws that only share an edge cover no pixel twice
+bool Overlaps(const DrawBounds &a, const DrawBounds &b) {
+  return a.left < b.right && b.left < a.right && a.bottom < b.top &&
+         b.bottom < a.top;
+}
+
+void Include(DrawBounds &into, const DrawBounds &bounds) {
+  into.left = std::min(into.left, bounds.left);
+  into.bottom = std::min(into.bottom, bounds.bottom);
+  into.right = std::max(into.right, bounds.right);
+  into.top = std::max(into.top, bounds.top);
+}
+
+} // namespace
+
+void DrawList::Add(uint64_t state, const DrawBounds &bounds, int payload) {
+  if (entries.empty() || state != lastState)
+    recordedChanges++;
+  lastState = state;
+
+  // The topmost layer with anything underneath decides: a draw of other
+  // state there must stay below this one, while one of the same state
+  // keeps its order within the layer. Nothing lower can ask for more.
+  int layer = 0;
+  for (int i = layerCount - 1; i >= 0; i--) {
+    bool below = false, level = false;
+    for (const Region &region : layers[i])
+      if (Overlaps(region.bounds, bounds))
+        (region.state == state ? level : below) = true;
+    if (below || level) {
+      layer = below ? i + 1 : i;
+      break;
+    }
+  }
+
+  if (layer == layerCount) {
+    if ((int)layers.size() == layerCount)
+      layers.emplace_back();
+    layers[layerCount++].clear();
+  }
+  std::vector<Region> &regions = layers[layer];
+  auto region =
+      std::find_if(regions.begin(), regions.end(),
+                   [state](const Region &r) { return r.state == state; });
+  if (region == regions.end())
+    regions.push_back({state, bounds});
+  else
+    Include(region->bounds, bounds);
+
+  entries.push_back({layer, state, payload});
+}
+
+const std::vector<DrawList::Entry> &DrawList::Sort() {
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const Entry &a, const Entry &b) {
+                     if (a.layer != b.layer)
+                       return a.layer < b.layer;
+                     return a.state < b.state;
+                   });
+  sortedChanges = 0;
+  for (size_t i = 0; i < entries.size(); i++)
+    if (i == 0 || entries[i].state != entries[i - 1].state)
+      sortedChanges++;
+  return entries;
+}
+
+void DrawList::Clear() {
+  entries.clear();
+  layerCount = 0;
+  recordedChanges = sortedChanges = 0;
+}
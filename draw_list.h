@@ -0,0 +1,64 @@
+// Draws recorded over a frame and submitted grouped by the GL state they
+// need, so that draws sharing a program and texture go out as one call
+// instead of one each. Reordering must not change the picture, so every
+// draw is put in a layer: above any earlier draw it overlaps that needs
+// other state, level with earlier overlapping draws that need the same
+// state. Layers are submitted in order and only the draws within one are
+// sorted, stably, where no two with different state overlap.
+#ifndef DRAW_LIST_H
+#define DRAW_LIST_H
+
+#include <cstdint>
+#include <vector>
+
+// Sort key for the state a draw needs: program first, since it is the
+// costliest to switch, then the texture or vertex buffer, then primitive
+inline uint64_t DrawState(int program, uint32_t texture, int primitive) {
+  return (uint64_t)program << 40 | (uint64_t)texture << 8 | (uint64_t)primitive;
+}
+
+inline int DrawStateProgram(uint64_t state) { return (int)(state >> 40); }
+
+// Extent of a draw in the units it was recorded in
+struct DrawBounds {
+  float left, bottom, right, top;
+};
+
+class DrawList {
+public:
+  struct Entry {
+    int layer;
+    uint64_t state;
+    int payload; // the backend's index for the draw's data
+  };
+
+  void Add(uint64_t state, const DrawBounds &bounds, int payload);
+  bool Empty() const { return entries.empty(); }
+
+  // Entries in submission order: by layer, then state, then recording
+  // order. Stays valid until the next Add or Clear.
+  const std::vector<Entry> &Sort();
+  // Entries in recording order, before any Sort
+  const std::vector<Entry> &Recorded() const { return entries; }
+  void Clear();
+
+  // State changes the draws need in recorded order, and sorted
+  int RecordedChanges() const { return recordedChanges; }
+  int SortedChanges() const { return sortedChanges; }
+
+private:
+  // Everything one state has drawn in one layer, as a single rectangle.
+  // Coarser than the draws themselves, which can only add layers.
+  struct Region {
+    uint64_t state;
+    DrawBounds bounds;
+  };
+
+  std::vector<Entry> entries;
+  std::vector<std::vector<Region>> layers; // kept across frames for reuse
+  int layerCount = 0;
+  uint64_t lastState = 0;
+  int recordedChanges = 0, sortedChanges = 0;
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include "engine.h"
+
+#include "bitmap_font.h"
+#include "render_backend.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+RenderBackend *renderer = nullptr;
+
+// ===== Tessellation Level of Detail =====
+// Curves are tessellated so no chord strays more than this from the true
+// edge, in window pixels; the fallback path has no antialiasing to show less
+const float kMaxPixelError = 0.5f;
+// Segment counts per level, each about 1.4 times the last and even so bowls
+// can take half. Every level caches its unit outlines.
+const int kLevelSegments[] = {6,  8,   12,  16,  24,  32,  48,
+                              64, 96, 128, 192, 256, 384, 512};
+const int kLevels = sizeof(kLevelSegments) / sizeof(kLevelSegments[0]);
+const int kMaxFanVertices = 512 + 2;
+
+// Window pixels per drawing unit under each pushed projection, times the
+// display scale. The top entry is the current one.
+float displayScale = 1;
+std::vector<float> unitPixels = {1};
+
+// A chord over 2 pi / n of a circle of radius r strays r (1 - cos(pi / n))
+// from the arc
+int LevelFor(float pixelRadius) {
+  for (int level = 0; level < kLevels - 1; level++)
+    if (pixelRadius * (1 - cos(M_PI / kLevelSegments[level])) <=
+        kMaxPixelError)
+      return level;
+  return kLevels - 1;
+}
+
+// Points around the unit circle, first repeated at the end to close a fan
+const std::vector<float> &UnitCircle(int level) {
+  static std::vector<float> rings[kLevels];
+  std::vector<float> &ring = rings[level];
+  if (ring.empty()) {
+    int segments = kLevelSegments[level];
+    for (int i = 0; i <= segments; i++) {
+      float ang = i * 2 * M_PI / segments;
+      ring.push_back(cos(ang));
+      ring.push_back(sin(ang));
+    }
+  }
+  return ring;
+}
+
+// drawHeart's outline at size 1, sampled evenly in its parameter
+const std::vector<float> &UnitHeart(int level) {
+  static std::vector<float> outlines[kLevels];
+  std::vector<float> &outline = outlines[level];
+  if (outline.empty()) {
+    int segments = kLevelSegments[level];
+    for (int i = 0; i <= segments; i++) {
+      float angle = i * 2 * M_PI / segments;
+      outline.push_back(16 * pow(sin(angle), 3));
+      outline.push_back(-(13 * cos(angle) - 5 * cos(2 * angle) -
+                          2 * cos(3 * angle) - cos(4 * angle)));
+    }
+  }
+  return outline;
+}
+
+std::array<float, kHeartOutlinePoints * 2> BuildHeartOutline() {
+  std::array<float, kHeartOutlinePoints * 2> outline;
+  for (int i = 0; i < kHeartOutlinePoints; i++) {
+    float angle = i * M_PI / (kHeartOutlinePoints - 1);
+    outline[i * 2] = 16 * pow(sin(angle), 3);
+    outline[i * 2 + 1] = -(13 * cos(angle) - 5 * cos(2 * angle) -
+                           2 * cos(3 * angle) - cos(4 * angle));
+  }
+  return outline;
+}
+
+} // namespace
+
+RenderBackend *Renderer() { return renderer; }
+
+const float *HeartOutline() {
+  // Built once by whichever thread gets here first; software tile jobs
+  // reach it in parallel
+  static const std::array<float, kHeartOutlinePoints * 2> outline =
+      BuildHeartOutline();
+  return outline.data();
+}
+void SetRenderer(RenderBackend *backend) { renderer = backend; }
+
+// ===== Utility Drawing Functions =====
+void drawRectangle(float x, float y, float w, float h, float r, float g,
+                   float b, float a) {
+  float v[] = {x, y, x + w, y, x + w, y + h, x, y + h};
+  renderer->FillPrimitive(PRIM_QUADS, v, 4, r, g, b, a);
+}
+
+void drawTriangle(float x1, float y1, float x2, float y2, float x3, float y3,
+                  float r, float g, float b, float a) {
+  float v[] = {x1, y1, x2, y2, x3, y3};
+  renderer->FillPrimitive(PRIM_TRIANGLES, v, 3, r, g, b, a);
+}
+
+void drawCircle(float cx, float cy, float r, float cr, float cg, float cb,
+                float ca) {
+  if (renderer->FillShape(SHAPE_CIRCLE, cx, cy, r, cr, cg, cb, ca))
+    return;
+  int level = LevelFor(r * unitPixels.back());
+  int segments = kLevelSegments[level];
+  const std::vector<float> &ring = UnitCircle(level);
+  float v[kMaxFanVertices * 2];
+  v[0] = cx;
+  v[1] = cy;
+  for (int i = 0; i <= segments; i++) {
+    v[i * 2 + 2] = cx + ring[i * 2] * r;
+    v[i * 2 + 3] = cy + ring[i * 2 + 1] * r;
+  }
+  renderer->FillPrimitive(PRIM_TRIANGLE_FAN, v, segments + 2, cr, cg, cb, ca);
+}
+
+// Lower half-disc, used for the porridge bowls
+void drawBowl(float cx, float cy, float radius, float r, float g, float b) {
+  if (renderer->FillShape(SHAPE_BOWL, cx, cy, radius, r, g, b, 1.0f))
+    return;
+  int level = LevelFor(radius * unitPixels.back());
+  const std::vector<float> &ring = UnitCircle(level);
+  int half = kLevelSegments[level] / 2;
+  float v[kMaxFanVertices * 2];
+  v[0] = cx;
+  v[1] = cy;
+  for (int i = 0; i <= half; i++) {
+    v[i * 2 + 2] = cx + ring[i * 2] * radius;
+    v[i * 2 + 3] = cy - ring[i * 2 + 1] * radius;
+  }
+  renderer->FillPrimitive(PRIM_TRIANGLE_FAN, v, half + 2, r, g, b, 1.0f);
+}
+
+// The outline spans 17 units from its middle but is sampled unevenly, with
+// the lobes and the tip packed into a few parameter steps; twice the
+// segments a circle that size needs keeps them smooth
+void drawHeart(float x, float y, float size, float r, float g, float b) {
+  if (renderer->FillShape(SHAPE_HEART, x, y, size, r, g, b, 1.0f))
+    return;
+  int level =
+      std::min(LevelFor(17 * size * unitPixels.back()) + 2, kLevels - 1);
+  int segments = kLevelSegments[level];
+  const std::vector<float> &outline = UnitHeart(level);
+  float v[kMaxFanVertices * 2];
+  for (int i = 0; i <= segments; i++) {
+    v[i * 2] = x + outline[i * 2] * size;
+    v[i * 2 + 1] = y + outline[i * 2 + 1] * size;
+  }
+  renderer->FillPrimitive(PRIM_TRIANGLE_FAN, v, segments + 1, r, g, b, 1.0f);
+}
+
+void drawTexture(GLuint texture, float x, float y, float w, float h) {
+  renderer->DrawTexture(texture, x, y, w, h);
+}
+
+void pushProjection(float left, float right, float bottom, float top) {
+  unitPixels.push_back(displayScale *
+                       std::max(WINDOW_WIDTH / fabsf(right - left),
+                                WINDOW_HEIGHT / fabsf(top - bottom)));
+  renderer->PushProjection(left, right, bottom, top);
+}
+
+void popProjection() {
+  if (unitPixels.size() > 1)
+    unitPixels.pop_back();
+  renderer->PopProjection();
+}
+
+void setDisplayScale(float scale) {
+  for (float &pixels : unitPixels)
+    pixels *= scale / displayScale;
+  displayScale = scale;
+}
+
+// ===== Text =====
+int textWidth(const char *text, void *font) {
+  const BitmapFont &bitmapFont = GetBitmapFont(font);
+  int width = 0;
+  for (int i = 0; text[i]; i++)
+    width += bitmapFont.Advance(text[i]);
+  return width;
+}
+
+void drawText(const char *text, float x, float y, void *font, float r,
+              float g, float b) {
+  renderer->DrawText(text, strlen(text), x, y, font, r, g, b);
+}
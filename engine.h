@@ -0,0 +1,51 @@
+// Shared window constants and drawing helpers used by every scene. The
+// helpers draw through the current RenderBackend (render_backend.h).
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <GL/glu.h>
+#include <GL/glut.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Window dimensions
+const int WINDOW_WIDTH = 900;
+const int WINDOW_HEIGHT = 600;
+
+// Fixed simulation step (the old per-scene 16 ms glutTimerFunc tick)
+const float kTickSeconds = 0.016f;
+
+// Converts a legacy "units per 16 ms tick" speed into units per second
+inline float PerTick(float perTick) { return perTick / kTickSeconds; }
+
+// ===== Utility Drawing Functions =====
+void drawRectangle(float x, float y, float w, float h, float r, float g,
+                   float b, float a = 1.0f);
+void drawTriangle(float x1, float y1, float x2, float y2, float x3, float y3,
+                  float r, float g, float b, float a = 1.0f);
+// Circles, bowls and hearts are analytic where the backend supports it.
+// Otherwise they are tessellated finely enough for their size on screen,
+// from unit outlines cached per level of detail.
+void drawCircle(float cx, float cy, float r, float cr, float cg, float cb,
+                float ca = 1.0f);
+void drawBowl(float cx, float cy, float radius, float r, float g, float b);
+void drawHeart(float x, float y, float size, float r, float g, float b);
+void drawTexture(GLuint texture, float x, float y, float w, float h);
+
+// Temporarily lays out drawing in other coordinates, e.g. (-1, 1, -1, 1)
+void pushProjection(float left, float right, float bottom, float top);
+void popProjection();
+
+// Window pixels per layout pixel when the window is resized, so curves keep
+// their smoothness when stretched
+void setDisplayScale(float scale);
+
+// ===== Text =====
+int textWidth(const char *text, void *font = GLUT_BITMAP_HELVETICA_18);
+void drawText(const char *text, float x, float y,
+              void *font = GLUT_BITMAP_HELVETICA_18, float r = 0.0f,
+              float g = 0.0f, float b = 0.0f);
+
+#endif
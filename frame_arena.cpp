@@ -0,0 +1,108 @@
+#include "frame_arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+FrameArena arenas[2];
+int currentArena = 0;
+
+#ifdef FRAME_ARENA_DEBUG
+std::atomic<long> heapAllocations{0};
+#endif
+
+} // namespace
+
+#ifdef FRAME_ARENA_DEBUG
+// Counted replacements for the global allocation functions. The aligned
+// forms keep the library's, which only matter for over-aligned types.
+void *operator new(size_t size) {
+  heapAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+#endif
+
+FrameArena::FrameArena(size_t blockSize) : blockSize(blockSize) {}
+
+FrameArena::~FrameArena() {
+  for (Block &block : blocks)
+    delete[] block.data;
+}
+
+void FrameArena::AddBlock(size_t size) {
+  blocks.push_back({new char[size], size});
+}
+
+void *FrameArena::Allocate(size_t size, size_t align) {
+  if (blocks.empty())
+    AddBlock(std::max(blockSize, size + align));
+  while (true) {
+    Block &block = blocks[current];
+    uintptr_t top = (uintptr_t)block.data + offset;
+    size_t start = offset + (align - top % align) % align;
+    if (start + size <= block.size) {
+      offset = start + size;
+      used += size;
+      return block.data + start;
+    }
+    // The rest of this block is wasted until the next Reset
+    if (++current == blocks.size())
+      AddBlock(std::max(blockSize, size + align));
+    offset = 0;
+  }
+}
+
+void FrameArena::Reset() {
+  if (blocks.size() > 1) {
+    size_t total = 0;
+    for (Block &block : blocks) {
+      total += block.size;
+      delete[] block.data;
+    }
+    blocks.clear();
+    AddBlock(total);
+  }
+  current = 0;
+  offset = 0;
+  used = 0;
+}
+
+void BeginFrameArena() {
+  currentArena ^= 1;
+  arenas[currentArena].Reset();
+}
+
+FrameArena &FrameMemory() { return arenas[currentArena]; }
+
+const char *FrameFormat(const char *format, ...) {
+  va_list args, copy;
+  va_start(args, format);
+  va_copy(copy, args);
+  int length = std::max(0, vsnprintf(nullptr, 0, format, args));
+  va_end(args);
+  char *text = (char *)FrameMemory().Allocate(length + 1, 1);
+  vsnprintf(text, length + 1, format, copy);
+  va_end(copy);
+  return text;
+}
+
+long TakeHeapAllocations() {
+#ifdef FRAME_ARENA_DEBUG
+  return heapAllocations.exchange(0, std::memory_order_relaxed);
+#else
+  return -1;
+#endif
+}
@@ -0,0 +1,91 @@
+// Scratch memory that lives for one frame. Strings and buffers needed only
+// while a frame is drawn are bumped out of a block that is rewound when the
+// next frame starts, instead of each going to the heap. Two arenas take
+// turns, so what a frame allocated stays valid while the frame after it is
+// drawn, for a renderer that consumes frames on another thread. Only the
+// thread that draws may allocate from them.
+//
+// Builds with -DFRAME_ARENA_DEBUG count every operator new, from any thread,
+// so a frame that still reaches the heap shows up in --run-frames and
+// --frame-stats.
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class FrameArena {
+public:
+  explicit FrameArena(size_t blockSize = 64 * 1024);
+  ~FrameArena();
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+
+  // Never fails; a full block chains another, which Reset folds into one
+  // block big enough for the whole frame, so a steady frame stops growing
+  void *Allocate(size_t size, size_t align = alignof(std::max_align_t));
+  // Frees everything allocated since the last Reset
+  void Reset();
+
+  size_t Used() const { return used; }
+
+private:
+  struct Block {
+    char *data;
+    size_t size;
+  };
+  void AddBlock(size_t size);
+
+  size_t blockSize;
+  std::vector<Block> blocks;
+  size_t current = 0; // block being bumped
+  size_t offset = 0;  // into the current block
+  size_t used = 0;
+};
+
+// Switches to the other arena and rewinds it; called as each frame starts
+void BeginFrameArena();
+// The arena of the frame being drawn
+FrameArena &FrameMemory();
+
+// printf into the frame's arena; valid until the frame after next begins
+const char *FrameFormat(const char *format, ...)
+    __attribute__((format(printf, 1, 2)));
+
+// Lets standard containers allocate from an arena; deallocation is a no-op
+// and the memory comes back when the arena is reset
+template <typename T> struct FrameAllocator {
+  using value_type = T;
+
+  FrameAllocator() : arena(&FrameMemory()) {}
+  explicit FrameAllocator(FrameArena &arena) : arena(&arena) {}
+  template <typename U>
+  FrameAllocator(const FrameAllocator<U> &other) : arena(other.arena) {}
+
+  T *allocate(size_t count) {
+    return static_cast<T *>(arena->Allocate(count * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, size_t) {}
+
+  FrameArena *arena;
+};
+
+template <typename T, typename U>
+bool operator==(const FrameAllocator<T> &a, const FrameAllocator<U> &b) {
+  return a.arena == b.arena;
+}
+template <typename T, typename U>
+bool operator!=(const FrameAllocator<T> &a, const FrameAllocator<U> &b) {
+  return a.arena != b.arena;
+}
+
+template <typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+using FrameString =
+    std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
+
+// Heap allocations since the last call, or -1 in builds without
+// FRAME_ARENA_DEBUG
+long TakeHeapAllocations();
+
+#endif
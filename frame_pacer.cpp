@@ -0,0 +1,92 @@
+#include "frame_pacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+// Sleeps can overshoot by scheduler slack; the last stretch is spun
+const std::chrono::microseconds kSpin(1500);
+const std::chrono::milliseconds kLate(1);
+
+} // namespace
+
+double FrameStats::Jitter() const {
+  if (frames < 2)
+    return 0;
+  double mean = Mean();
+  return std::sqrt(std::max(squares / frames - mean * mean, 0.0));
+}
+
+FramePacer::FramePacer(float periodSeconds)
+    : period(std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<float>(periodSeconds))) {}
+
+void FramePacer::Resume() {
+  started = false;
+  lastStart = Clock::time_point();
+  owed = Clock::duration(0);
+}
+
+int FramePacer::Wait(bool precise) {
+  Clock::time_point now = Clock::now();
+  if (!started) {
+    started = true;
+    deadline = now;
+  }
+
+  if (vsync) {
+    // A frame that skipped its redraw has no swap to block on
+    if (!precise && lastStart != Clock::time_point() &&
+        now < lastStart + period) {
+      std::this_thread::sleep_until(lastStart + period);
+      now = Clock::now();
+    }
+    if (lastStart != Clock::time_point())
+      owed += now - lastStart;
+    Record(now);
+    int ticks = (int)(owed / period);
+    owed -= ticks * period;
+    if (ticks > kMaxCatchUp) {
+      ticks = kMaxCatchUp;
+      owed = Clock::duration(0);
+    }
+    return ticks;
+  }
+
+  if (!precise)
+    std::this_thread::sleep_until(deadline);
+  else if (deadline - now > kSpin)
+    std::this_thread::sleep_until(deadline - kSpin);
+  while ((now = Clock::now()) < deadline)
+    std::this_thread::yield();
+  if (now - deadline > kLate)
+    stats.late++;
+  Record(now);
+
+  // One tick for this deadline and one for each passed since
+  int ticks = 1;
+  deadline += period;
+  while (deadline <= now && ticks < kMaxCatchUp) {
+    deadline += period;
+    ticks++;
+  }
+  if (deadline <= now)
+    deadline = now + period;
+  return ticks;
+}
+
+void FramePacer::Record(Clock::time_point start) {
+  Clock::time_point previous = lastStart;
+  lastStart = start;
+  if (previous == Clock::time_point())
+    return; // the first frame has no interval
+  double ms =
+      std::chrono::duration<double, std::milli>(start - previous).count();
+  stats.frames++;
+  stats.total += ms;
+  stats.squares += ms * ms;
+  stats.shortest = std::min(stats.shortest, ms);
+  stats.longest = std::max(stats.longest, ms);
+}
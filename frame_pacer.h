@@ -0,0 +1,58 @@
+// Fixed-rate pacing for the main loop and the game's simulation thread.
+// Each frame has a deadline one period after the last on a steady clock;
+// the pacer sleeps until just short of it, where the OS can still wake it
+// late, and spins the rest so frames start within microseconds of it.
+// Deadlines follow from one another rather than from when a frame woke, so
+// lateness never accumulates.
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <chrono>
+
+// Intervals between frame starts, in milliseconds
+struct FrameStats {
+  int frames = 0;
+  int late = 0; // started over a millisecond after their deadline
+  double total = 0, squares = 0;
+  double shortest = 1e30, longest = 0;
+
+  double Mean() const { return frames ? total / frames : 0; }
+  double Jitter() const; // standard deviation
+};
+
+class FramePacer {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit FramePacer(float periodSeconds);
+
+  // With vsync the buffer swap already blocks until the display is ready,
+  // so Wait only measures and owes ticks for the time that has passed; a
+  // frame that will not be drawn still sleeps out the rest of its period
+  void SetVsync(bool vsync) { this->vsync = vsync; }
+
+  // Waits for the next frame and returns how many fixed periods it owes:
+  // normally 1, more after a hiccup, at most kMaxCatchUp so a long stall is
+  // skipped rather than replayed. Without precise it only sleeps, for
+  // frames that will not be drawn.
+  int Wait(bool precise = true);
+  // Starts afresh after the loop slept, owing nothing for the gap
+  void Resume();
+
+  const FrameStats &Stats() const { return stats; }
+  void ResetStats() { stats = FrameStats(); }
+
+  static const int kMaxCatchUp = 5;
+
+private:
+  void Record(Clock::time_point start);
+
+  Clock::duration period;
+  bool vsync = false;
+  bool started = false;
+  Clock::time_point deadline, lastStart;
+  Clock::duration owed{0}; // vsync: time not yet turned into ticks
+  FrameStats stats;
+};
+
+#endif
@@ -1,39 +1,22 @@
-#include <GL/glu.h>
-#include <GL/glut.h>
-#include <cmath>
+#include "background.h"
+#include "catcher_bot.h"
+#include "engine.h"
+#include "frame_arena.h"
+#include "frame_pacer.h"
+#include "game_rules.h"
+#include "random.h"
+#include "scene.h"
+#include "spsc_queue.h"
+#include "triple_buffer.h"
+
+#include <atomic>
+#include <condition_variable>
 #include <cstdlib>
-#include <ctime>
 #include <iostream>
-#include <string>
+#include <mutex>
+#include <thread>
 #include <vector>
 
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-// Window dimensions
-const int WINDOW_WIDTH = 900;
-const int WINDOW_HEIGHT = 600;
-
-// Game constants
-const float BASKET_SPEED = 300.0f;
-const float BASE_ITEM_FALL_SPEED = 100.0f;
-const float BASE_ITEM_SPAWN_INTERVAL = 1.5f;
-const int STARTING_LIVES = 3;
-
-enum Season { SPRING, SUMMER, AUTUMN, WINTER };
-
-// ===== Seasonal Scene Variables =====
-float sunX = -50.0f;       // Sun starting X
-float sunSpeed = 1.0f;     // Sun horizontal speed
-float cloudX[3];           // Clouds horizontal positions
-float fireOffset[5] = {0}; // Fire flicker offsets
-
-struct Snowflake {
-  float x, y, size;
-};
-std::vector<Snowflake> snowflakes;
-
 // ===== Game Structures =====
 struct Item {
   float x, y;
@@ -41,195 +24,30 @@ struct Item {
   float r, g, b, a;
   bool isGood;
   float velocity;
-  std::string type;
+  const char *type;
 };
 
-// ===== Utility Drawing Functions for Seasonal Scene =====
-void drawRectangle(float x, float y, float w, float h, float r, float g,
-                   float b) {
-  glColor3f(r, g, b);
-  glBegin(GL_QUADS);
-  glVertex2f(x, y);
-  glVertex2f(x + w, y);
-  glVertex2f(x + w, y + h);
-  glVertex2f(x, y + h);
-  glEnd();
-}
-
-void drawTriangle(float x1, float y1, float x2, float y2, float x3, float y3,
-                  float r, float g, float b) {
-  glColor3f(r, g, b);
-  glBegin(GL_TRIANGLES);
-  glVertex2f(x1, y1);
-  glVertex2f(x2, y2);
-  glVertex2f(x3, y3);
-  glEnd();
-}
-
-void drawCircle(float cx, float cy, float r, int segments, float cr, float cg,
-                float cb) {
-  glColor3f(cr, cg, cb);
-  glBegin(GL_TRIANGLE_FAN);
-  glVertex2f(cx, cy);
-  for (int i = 0; i <= segments; i++) {
-    float ang = i * 2 * M_PI / segments;
-    glVertex2f(cx + cos(ang) * r, cy + sin(ang) * r);
-  }
-  glEnd();
-}
-
-// ===== Heart Drawing Function =====
-void drawHeart(float x, float y, float size, float r, float g, float b) {
-  glColor3f(r, g, b);
-  glBegin(GL_TRIANGLE_FAN);
-
-  // Main body of the heart
-  for (int i = 0; i <= 360; i++) {
-    float angle = i * M_PI / 180.0f;
-    // Heart parametric equations
-    float xPos = size * 16 * pow(sin(angle), 3);
-    float yPos = -size * (13 * cos(angle) - 5 * cos(2 * angle) -
-                          2 * cos(3 * angle) - cos(4 * angle));
-
-    glVertex2f(x + xPos, y + yPos);
-  }
-  glEnd();
-}
-
-// ===== Seasonal Scene Drawing Functions =====
-void drawSun(float x) {
-  float h = WINDOW_WIDTH / 2.0f;
-  float k = 520;
-  float a = -0.0015f;
-  float y = a * (x - h) * (x - h) + k;
-
-  drawCircle(x, y, 50, 60, 1.0f, 0.9f, 0.0f);
-
-  for (int i = 0; i < 12; i++) {
-    float ang = i * (2 * M_PI / 12);
-    float x1 = x + cos(ang) * 60;
-    float y1 = y + sin(ang) * 60;
-    float x2 = x + cos(ang + 0.2f) * 75;
-    float y2 = y + sin(ang + 0.2f) * 75;
-    float x3 = x + cos(ang - 0.2f) * 75;
-    float y3 = y + sin(ang - 0.2f) * 75;
-    drawTriangle(x1, y1, x2, y2, x3, y3, 1.0f, 0.8f, 0.0f);
-  }
-}
-
-void drawCloud(float x, float y) {
-  drawCircle(x, y, 30, 20, 1, 1, 1);
-  drawCircle(x + 25, y + 10, 25, 20, 1, 1, 1);
-  drawCircle(x - 25, y + 10, 25, 20, 1, 1, 1);
-  drawCircle(x, y + 15, 28, 20, 1, 1, 1);
-}
-
-void drawFlower(float x, float y) {
-  float petalR = 10;
-  drawCircle(x, y + petalR, petalR, 20, 1, 0.6f, 0.8f);
-  drawCircle(x, y - petalR, petalR, 20, 1, 0.6f, 0.8f);
-  drawCircle(x + petalR, y, petalR, 20, 1, 0.6f, 0.8f);
-  drawCircle(x - petalR, y, petalR, 20, 1, 0.6f, 0.8f);
-  drawCircle(x, y, petalR * 0.7f, 20, 1, 1, 0.2f);
-}
-
-void drawTree(float x, float y, bool flowers, bool autumn, bool winter) {
-  // trunk
-  drawRectangle(x, y, 35, 120, 0.55f, 0.27f, 0.07f);
-
-  float lx = x + 18;
-  float ly = y + 110;
-
-  if (winter) {
-    drawCircle(lx, ly, 55, 30, 1.0f, 1.0f, 1.0f);
-    return;
-  }
-  if (autumn) {
-    drawCircle(lx, ly, 55, 30, 0.929f, 0.608f, 0.125f);
-    drawCircle(lx - 35, ly - 10, 45, 30, 0.929f, 0.608f, 0.125f);
-    drawCircle(lx + 35, ly - 10, 45, 30, 0.929f, 0.608f, 0.125f);
-    drawCircle(lx, ly + 30, 50, 30, 0.95f, 0.65f, 0.2f);
-    return;
-  }
-
-  // leaves
-  drawCircle(lx, ly, 55, 30, 0.0f, 0.7f, 0.1f);
-  drawCircle(lx - 35, ly - 10, 45, 30, 0.0f, 0.75f, 0.05f);
-  drawCircle(lx + 35, ly - 10, 45, 30, 0.0f, 0.75f, 0.05f);
-  drawCircle(lx, ly + 30, 50, 30, 0.0f, 0.8f, 0.1f);
-
-  if (flowers) {
-    drawFlower(x + 5, y + 170);
-    drawFlower(x + 40, y + 140);
-    drawFlower(x + 10, y + 120);
-  }
-}
+// Everything the renderer needs for one frame. The simulation thread fills
+// one of these per tick and hands it over through a triple buffer, so it is
+// plain data with a fixed item capacity.
+const int kMaxSnapshotItems = 64;
 
-void drawFire(float x, float y, float offset) {
-  drawTriangle(x - 20, y, x + 20, y, x, y + 40 + offset, 1.0f, 0.3f, 0.0f);
-  drawTriangle(x - 15, y + 20, x + 15, y + 20, x, y + 55 + offset, 1.0f, 0.6f,
-               0.0f);
-  drawTriangle(x - 10, y + 35, x + 10, y + 35, x, y + 65 + offset, 1.0f, 0.9f,
-               0.0f);
-}
+struct GameSnapshot {
+  float basketX, basketY;
+  float basketWidth, basketHeight;
+  Item items[kMaxSnapshotItems];
+  int itemCount;
 
-void DrawSeasonalBackground(Season currentSeason) {
-  // Ground & Sky by Season
-  if (currentSeason == SPRING) {
-    drawRectangle(0, 120, WINDOW_WIDTH, 480, 0.46f, 0.92f, 0.96f);
-    drawSun(sunX);
-    drawRectangle(0, 0, WINDOW_WIDTH, 120, 0.0f, 0.75f, 0.29f);
-  } else if (currentSeason == SUMMER) {
-    drawRectangle(0, 120, WINDOW_WIDTH, 480, 0.46f, 0.92f, 0.96f);
-    drawSun(sunX);
-    drawRectangle(0, 0, WINDOW_WIDTH, 120, 0.0f, 0.75f, 0.29f);
-  } else if (currentSeason == AUTUMN) {
-    drawRectangle(0, 120, WINDOW_WIDTH, 480, 0.45f, 0.65f, 1.0f);
-    drawSun(sunX);
-    drawRectangle(0, 0, WINDOW_WIDTH, 120, 0.8588f, 0.5882f, 0.1843f);
-  } else if (currentSeason == WINTER) {
-    drawRectangle(0, 120, WINDOW_WIDTH, 480, 0.8f, 0.9f, 1.0f);
-    drawSun(sunX);
-    drawRectangle(0, 0, WINDOW_WIDTH, 120, 1.0f, 1.0f, 1.0f);
-  }
-
-  // Clouds
-  drawCloud(cloudX[0], 500);
-  drawCloud(cloudX[1], 550);
-  drawCloud(cloudX[2], 480);
-
-  // House
-  drawRectangle(120, 120, 150, 100, 0.98f, 0.76f, 0.29f);          // base
-  drawTriangle(100, 220, 290, 220, 195, 300, 0.45f, 0.17f, 0.02f); // roof
-  drawRectangle(180, 120, 40, 70, 0.05f, 0.05f, 0.05f);            // door
-
-  // Summer Fire
-  if (currentSeason == SUMMER) {
-    drawFire(150, 250, fireOffset[0]);
-    drawFire(230, 252, fireOffset[1]);
-  }
-
-  // Trees
-  drawTree(600, 120, currentSeason == SPRING, currentSeason == AUTUMN,
-           currentSeason == WINTER);
-  drawTree(700, 120, currentSeason == SPRING, currentSeason == AUTUMN,
-           currentSeason == WINTER);
-  drawTree(800, 120, currentSeason == SPRING, currentSeason == AUTUMN,
-           currentSeason == WINTER);
-
-  // Additional fire near trees (summer)
-  if (currentSeason == SUMMER) {
-    drawFire(613, 250, fireOffset[2]);
-    drawFire(710, 245, fireOffset[3]);
-    drawFire(817, 253, fireOffset[4]);
-  }
-
-  // Snow for winter
-  if (currentSeason == WINTER) {
-    for (auto &s : snowflakes)
-      drawCircle(s.x, s.y, s.size, 10, 1, 1, 1);
-  }
-}
+  int score;
+  int lives;
+  int level;
+  Season season;
+  bool paused;
+  bool gameOver;
+  bool showLevelUp;
+  float levelUpTimer;
+  SkyState sky;
+};
 
 // ===== Game Class =====
 class Game {
@@ -248,10 +66,11 @@ private:
   float levelUpTimer;      // Timer for level up message display
 
   std::vector<Item> items;
+  SkyState sky; // Animated seasonal background
+  Random random; // Item positions, kinds and names
 
   float itemSpawnTimer;
   float deltaTime;
-  float lastFrame;
 
   bool leftKey, rightKey, spaceKey, escapeKey;
 
@@ -260,16 +79,18 @@ public:
       : score(0), lives(STARTING_LIVES), level(1), currentSeason(SPRING),
         paused(false), gameOver(false), hasCompletedWinter(false),
         showLevelUp(false), levelUpTimer(0.0f), itemSpawnTimer(0.0f),
-        deltaTime(0.0f), lastFrame(0.0f), leftKey(false), rightKey(false),
+        deltaTime(0.0f), leftKey(false), rightKey(false),
         spaceKey(false), escapeKey(false) {
 
-    basketWidth = 100.0f;
-    basketHeight = 60.0f;
+    basketWidth = BASKET_WIDTH;
+    basketHeight = BASKET_HEIGHT;
     // Position basket at the bottom of the screen
     basketX = WINDOW_WIDTH / 2 - basketWidth / 2;
-    basketY = 20; // Near the bottom
+    basketY = BASKET_Y;
 
-    srand(time(nullptr));
+    random = NewRandom(RANDOM_ITEMS);
+    InitSky(sky);
+    items.reserve(kMaxSnapshotItems); // spawning never reallocates
   }
 
   float GetItemFallSpeed() {
@@ -286,7 +107,7 @@ public:
     const int SUMMER_THRESHOLD = 50;
     const int AUTUMN_THRESHOLD = 100;
     const int WINTER_THRESHOLD = 150;
-    const int LEVEL_UP_THRESHOLD = 200; // Complete all seasons
+    const int LEVEL_UP_THRESHOLD = LEVEL_UP_SCORE;
 
     Season previousSeason = currentSeason;
 
@@ -361,48 +182,30 @@ public:
     }
   }
 
-  std::string GetRandomItemName(Season season, bool isGood) {
-    if (!isGood) {
-      std::vector<std::string> badItems = {"Trash", "Rotten", "Broken"};
-      return badItems[rand() % badItems.size()];
-    }
+  const char *GetRandomItemName(Season season, bool isGood) {
+    static const char *const badItems[] = {"Trash", "Rotten", "Broken"};
+    static const char *const seasonItems[4][4] = {
+        {"Cherry Blossom", "Flower", "Honey", "Apple"},
+        {"Lemon", "Sunflower", "IceCream", "Sun"},
+        {"Maple Leaf", "Pumpkin", "Corn", "Apple"},
+        {"Snowflake", "Cocoa", "Cookie", "Scarf"}};
 
-    switch (season) {
-    case SPRING: {
-      std::vector<std::string> items = {"Cherry Blossom", "Flower", "Honey",
-                                        "Apple"};
-      return items[rand() % items.size()];
-    }
-    case SUMMER: {
-      std::vector<std::string> items = {"Lemon", "Sunflower", "IceCream",
-                                        "Sun"};
-      return items[rand() % items.size()];
-    }
-    case AUTUMN: {
-      std::vector<std::string> items = {"Maple Leaf", "Pumpkin", "Corn",
-                                        "Apple"};
-      return items[rand() % items.size()];
-    }
-    case WINTER: {
-      std::vector<std::string> items = {"Snowflake", "Cocoa", "Cookie",
-                                        "Scarf"};
-      return items[rand() % items.size()];
-    }
-    default:
+    if (!isGood)
+      return badItems[random.Below(3)];
+    if (season < SPRING || season > WINTER)
       return "Item";
-    }
+    return seasonItems[season][random.Below(4)];
   }
 
   void SpawnItem() {
     Item item;
-    item.size = 40.0f;
-    item.x = rand() % (WINDOW_WIDTH - (int)item.size);
+    item.size = ITEM_SIZE;
+    item.x = random.Below(WINDOW_WIDTH - (int)item.size);
     // Spawn items from the TOP of the screen
     item.y = WINDOW_HEIGHT; // Start at top
     item.velocity = GetItemFallSpeed() + (score / 10.0f);
 
-    int goodChance = 70;
-    bool spawnGood = (rand() % 100) < goodChance;
+    bool spawnGood = random.Below(100) < GOOD_ITEM_CHANCE;
 
     item.isGood = spawnGood;
     GetSeasonItemColor(currentSeason, spawnGood, item.r, item.g, item.b);
@@ -417,13 +220,17 @@ public:
     return (x1 < x2 + w2 && x1 + w1 > x2 && y1 < y2 + h2 && y1 + h1 > y2);
   }
 
-  void Update() {
+  // Background animation keeps running while paused
+  void UpdateScenery(float dt) { UpdateSky(sky, currentSeason, dt); }
+
+  // Whether play moves on by itself, rather than waiting for a key
+  bool IsLive() const { return !paused && !gameOver; }
+
+  void Update(float dt) {
     if (gameOver || paused)
       return;
 
-    float currentTime = glutGet(GLUT_ELAPSED_TIME) / 1000.0f;
-    deltaTime = currentTime - lastFrame;
-    lastFrame = currentTime;
+    deltaTime = dt;
 
     // Update level up timer
     if (showLevelUp) {
@@ -457,7 +264,7 @@ public:
       if (CheckCollision(it->x, it->y, it->size, it->size, basketX, basketY,
                          basketWidth, basketHeight)) {
         if (it->isGood) {
-          score += 10;
+          score += ITEM_POINTS;
           UpdateSeason();
         } else {
           lives--;
@@ -474,140 +281,30 @@ public:
     }
   }
 
-  void DrawRect(float x, float y, float width, float height, float r, float g,
-                float b, float a = 1.0f) {
-    glColor4f(r, g, b, a);
-    glBegin(GL_QUADS);
-    glVertex2f(x, y);
-    glVertex2f(x + width, y);
-    glVertex2f(x + width, y + height);
-    glVertex2f(x, y + height);
-    glEnd();
-  }
-
-  void DrawText(const std::string &text, float x, float y, float r, float g,
-                float b) {
-    glColor3f(r, g, b);
-    glRasterPos2f(x, y);
-    for (char c : text) {
-      glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, c);
-    }
-  }
-
-  void DrawLargeText(const std::string &text, float x, float y, float r,
-                     float g, float b) {
-    glColor3f(r, g, b);
-    glRasterPos2f(x, y);
-    for (char c : text) {
-      glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, c);
-    }
-  }
-
-  void DrawHearts() {
-    float startX = 60; // Moved right to make space for "Heart" text
-    float startY = WINDOW_HEIGHT - 45;
-    float spacing = 30;
-
-    for (int i = 0; i < STARTING_LIVES; i++) {
-      if (i < lives) {
-        // Full hearts for remaining lives
-        drawHeart(startX + i * spacing, startY, 0.15f, 1.0f, 0.3f, 0.3f);
-      } else {
-        // Empty/gray hearts for lost lives
-        drawHeart(startX + i * spacing, startY, 0.15f, 0.5f, 0.5f, 0.5f);
-      }
-    }
-  }
-
-  void RenderLevelUpMessage() {
-    // Semi-transparent background covering most of the screen
-    DrawRect(WINDOW_WIDTH / 2 - 200, WINDOW_HEIGHT / 2 - 100, 400, 200, 0.0f,
-             0.0f, 0.0f, 0.85f);
-
-    // Yellow border for emphasis
-    DrawRect(WINDOW_WIDTH / 2 - 202, WINDOW_HEIGHT / 2 - 102, 404, 204, 1.0f,
-             1.0f, 0.0f, 1.0f);
-
-    // Main "LEVEL UP!" text - large and centered
-    DrawLargeText("LEVEL UP!", WINDOW_WIDTH / 2 - 70, WINDOW_HEIGHT / 2 + 40,
-                  1.0f, 1.0f, 0.0f);
-
-    // Level information - medium size
-    DrawLargeText("Now at Level " + std::to_string(level),
-                  WINDOW_WIDTH / 2 - 90, WINDOW_HEIGHT / 2, 1.0f, 1.0f, 1.0f);
-
-    // Speed increase info
-    DrawText("Items are now " + std::to_string(level * 100) + "% faster!",
-             WINDOW_WIDTH / 2 - 120, WINDOW_HEIGHT / 2 - 30, 0.8f, 0.8f, 1.0f);
-
-    // Countdown timer
-    DrawText("Message disappears in " + std::to_string((int)levelUpTimer + 1) +
-                 " seconds...",
-             WINDOW_WIDTH / 2 - 140, WINDOW_HEIGHT / 2 - 60, 1.0f, 0.5f, 0.5f);
-  }
-
-  void Render() {
-    glClear(GL_COLOR_BUFFER_BIT);
-
-    // Draw seasonal background
-    DrawSeasonalBackground(currentSeason);
-
-    // Draw basket (at bottom)
-    DrawRect(basketX, basketY, basketWidth, basketHeight, 0.6f, 0.4f, 0.2f);
-
-    // Draw items (falling from top to bottom)
-    for (const auto &item : items) {
-      DrawRect(item.x, item.y, item.size, item.size, item.r, item.g, item.b,
-               item.a);
-    }
-
-    // Draw UI with semi-transparent background (moved to top)
-    DrawRect(5, WINDOW_HEIGHT - 85, 150, 80, 0.0f, 0.0f, 0.0f, 0.5f);
-    DrawText("Score: " + std::to_string(score), 10, WINDOW_HEIGHT - 70, 1.0f,
-             1.0f, 1.0f);
-    DrawText("Level: " + std::to_string(level), 10, WINDOW_HEIGHT - 55, 1.0f,
-             1.0f, 1.0f);
-
-    // Draw "Heart" text and hearts
-    DrawText("Heart:", 10, WINDOW_HEIGHT - 45, 1.0f, 1.0f, 1.0f);
-    DrawHearts();
-
-    DrawText("Season: " + std::string(GetSeasonName()), 10, WINDOW_HEIGHT - 30,
-             1.0f, 1.0f, 1.0f);
-
-    // Draw Level Up message in center (on top of everything)
-    if (showLevelUp) {
-      RenderLevelUpMessage();
-    }
-
-    if (paused && !gameOver) {
-      DrawRect(WINDOW_WIDTH / 2 - 60, WINDOW_HEIGHT / 2 - 15, 120, 30, 0.0f,
-               0.0f, 0.0f, 0.8f);
-      DrawText("PAUSED", WINDOW_WIDTH / 2 - 30, WINDOW_HEIGHT / 2 - 5, 1.0f,
-               1.0f, 0.0f);
-    }
-
-    if (gameOver) {
-      DrawRect(WINDOW_WIDTH / 2 - 100, WINDOW_HEIGHT / 2 - 50, 200, 100, 0.0f,
-               0.0f, 0.0f, 0.9f);
-      DrawText("GAME OVER", WINDOW_WIDTH / 2 - 45, WINDOW_HEIGHT / 2 - 30, 1.0f,
-               0.0f, 0.0f);
-      DrawText("Score: " + std::to_string(score), WINDOW_WIDTH / 2 - 40,
-               WINDOW_HEIGHT / 2, 1.0f, 1.0f, 1.0f);
-      DrawText("Level: " + std::to_string(level), WINDOW_WIDTH / 2 - 40,
-               WINDOW_HEIGHT / 2 + 15, 1.0f, 1.0f, 1.0f);
-      DrawText("Press SPACE to restart", WINDOW_WIDTH / 2 - 80,
-               WINDOW_HEIGHT / 2 + 35, 1.0f, 1.0f, 0.0f);
-    }
-
-    glutSwapBuffers();
-  }
-
-  void HandleKeyPress(unsigned char key, int x, int y) {
+  // Copies the state the renderer needs; called once per simulation tick
+  void Snapshot(GameSnapshot &out) const {
+    out.basketX = basketX;
+    out.basketY = basketY;
+    out.basketWidth = basketWidth;
+    out.basketHeight = basketHeight;
+    out.itemCount = 0;
+    for (const Item &item : items)
+      if (out.itemCount < kMaxSnapshotItems)
+        out.items[out.itemCount++] = item;
+
+    out.score = score;
+    out.lives = lives;
+    out.level = level;
+    out.season = currentSeason;
+    out.paused = paused;
+    out.gameOver = gameOver;
+    out.showLevelUp = showLevelUp;
+    out.levelUpTimer = levelUpTimer;
+    out.sky = sky; // particle storage is reserved once, so no reallocation
+  }
+
+  void HandleKeyPress(unsigned char key, int /*x*/, int /*y*/) {
     switch (key) {
-    case 27: // ESC key
-      exit(0);
-      break;
     case ' ': // Space key
       if (gameOver) {
         Reset();
@@ -632,7 +329,7 @@ public:
     }
   }
 
-  void HandleKeyRelease(unsigned char key, int x, int y) {
+  void HandleKeyRelease(unsigned char key, int /*x*/, int /*y*/) {
     switch (key) {
     case 'a':
     case 'A':
@@ -645,7 +342,7 @@ public:
     }
   }
 
-  void HandleSpecialKeyPress(int key, int x, int y) {
+  void HandleSpecialKeyPress(int key, int /*x*/, int /*y*/) {
     switch (key) {
     case GLUT_KEY_LEFT:
       leftKey = true;
@@ -656,7 +353,7 @@ public:
     }
   }
 
-  void HandleSpecialKeyRelease(int key, int x, int y) {
+  void HandleSpecialKeyRelease(int key, int /*x*/, int /*y*/) {
     switch (key) {
     case GLUT_KEY_LEFT:
       leftKey = false;
@@ -667,21 +364,6 @@ public:
     }
   }
 
-  const char *GetSeasonName() {
-    switch (currentSeason) {
-    case SPRING:
-      return "SPRING";
-    case SUMMER:
-      return "SUMMER";
-    case AUTUMN:
-      return "AUTUMN";
-    case WINTER:
-      return "WINTER";
-    default:
-      return "UNKNOWN";
-    }
-  }
-
   void Reset() {
     score = 0;
     lives = STARTING_LIVES;
@@ -694,140 +376,356 @@ public:
     items.clear();
     itemSpawnTimer = 0.0f;
     basketX = WINDOW_WIDTH / 2 - basketWidth / 2;
-    basketY = 20; // Reset to bottom position
+    basketY = BASKET_Y; // Reset to bottom position
     leftKey = false;
     rightKey = false;
   }
 
   Season GetCurrentSeason() const { return currentSeason; }
-};
 
-Game *game = nullptr;
+  // Holds the arrow keys the bot picks for this tick, and restarts a
+  // finished game so a soak test runs on unattended
+  void Autoplay() {
+    if (gameOver) {
+      std::cout << "Bot game over at level " << level << ", score " << score
+                << std::endl;
+      HandleKeyPress(' ', 0, 0);
+      return;
+    }
+
+    BotItem planned[kMaxSnapshotItems];
+    int count = 0;
+    for (const Item &item : items)
+      if (count < kMaxSnapshotItems)
+        planned[count++] = {item.x, item.y, item.velocity,
+                            item.isGood ? 1.0f : -1.0f};
+    int move = PlanBasketMove(basketX, planned, count);
+    if (move < 0)
+      HandleSpecialKeyPress(GLUT_KEY_LEFT, 0, 0);
+    else
+      HandleSpecialKeyRelease(GLUT_KEY_LEFT, 0, 0);
+    if (move > 0)
+      HandleSpecialKeyPress(GLUT_KEY_RIGHT, 0, 0);
+    else
+      HandleSpecialKeyRelease(GLUT_KEY_RIGHT, 0, 0);
+  }
+};
 
-void display() {
-  if (game) {
-    game->Render();
+// ===== Game Rendering =====
+// Draws only from a snapshot, never from the live Game, so the render thread
+// and the simulation thread share nothing but the triple buffer.
+
+const char *GetSeasonName(Season season) {
+  switch (season) {
+  case SPRING:
+    return "SPRING";
+  case SUMMER:
+    return "SUMMER";
+  case AUTUMN:
+    return "AUTUMN";
+  case WINTER:
+    return "WINTER";
+  default:
+    return "UNKNOWN";
   }
 }
 
-void updateScene(int value) {
-  // Sun animation
-  sunX += sunSpeed;
-  if (sunX > WINDOW_WIDTH + 50)
-    sunX = -50.0f;
-
-  // Clouds animation
-  for (int i = 0; i < 3; i++) {
-    cloudX[i] += 0.5f + i * 0.2f;
-    if (cloudX[i] > WINDOW_WIDTH + 50)
-      cloudX[i] = -50.0f;
-  }
-
-  // Fire flicker
-  for (int i = 0; i < 5; i++)
-    fireOffset[i] = rand() % 10;
-
-  // Snow animation (only in winter)
-  if (game && game->GetCurrentSeason() == WINTER) {
-    for (auto &s : snowflakes) {
-      s.y -= 2;
-      if (s.y < 0)
-        s.y = WINDOW_HEIGHT;
+void DrawRect(float x, float y, float width, float height, float r, float g,
+              float b, float a = 1.0f) {
+  drawRectangle(x, y, width, height, r, g, b, a);
+}
+
+void DrawText(const char *text, float x, float y, float r, float g, float b) {
+  drawText(text, x, y, GLUT_BITMAP_HELVETICA_12, r, g, b);
+}
+
+void DrawLargeText(const char *text, float x, float y, float r, float g,
+                   float b) {
+  drawText(text, x, y, GLUT_BITMAP_HELVETICA_18, r, g, b);
+}
+
+void DrawHearts(int lives) {
+  float startX = 60; // Moved right to make space for "Heart" text
+  float startY = WINDOW_HEIGHT - 45;
+  float spacing = 30;
+
+  for (int i = 0; i < STARTING_LIVES; i++) {
+    if (i < lives) {
+      // Full hearts for remaining lives
+      drawHeart(startX + i * spacing, startY, 0.15f, 1.0f, 0.3f, 0.3f);
+    } else {
+      // Empty/gray hearts for lost lives
+      drawHeart(startX + i * spacing, startY, 0.15f, 0.5f, 0.5f, 0.5f);
     }
   }
+}
 
-  glutPostRedisplay();
-  glutTimerFunc(16, updateScene, 0);
+void RenderLevelUpMessage(const GameSnapshot &s) {
+  // Semi-transparent background covering most of the screen
+  DrawRect(WINDOW_WIDTH / 2 - 200, WINDOW_HEIGHT / 2 - 100, 400, 200, 0.0f,
+           0.0f, 0.0f, 0.85f);
+
+  // Yellow border for emphasis
+  DrawRect(WINDOW_WIDTH / 2 - 202, WINDOW_HEIGHT / 2 - 102, 404, 204, 1.0f,
+           1.0f, 0.0f, 1.0f);
+
+  // Main "LEVEL UP!" text - large and centered
+  DrawLargeText("LEVEL UP!", WINDOW_WIDTH / 2 - 70, WINDOW_HEIGHT / 2 + 40,
+                1.0f, 1.0f, 0.0f);
+
+  // Level information - medium size
+  DrawLargeText(FrameFormat("Now at Level %d", s.level),
+                WINDOW_WIDTH / 2 - 90, WINDOW_HEIGHT / 2, 1.0f, 1.0f, 1.0f);
+
+  // Speed increase info
+  DrawText(FrameFormat("Items are now %d%% faster!", s.level * 100),
+           WINDOW_WIDTH / 2 - 120, WINDOW_HEIGHT / 2 - 30, 0.8f, 0.8f, 1.0f);
+
+  // Countdown timer
+  DrawText(FrameFormat("Message disappears in %d seconds...",
+                       (int)s.levelUpTimer + 1),
+           WINDOW_WIDTH / 2 - 140, WINDOW_HEIGHT / 2 - 60, 1.0f, 0.5f, 0.5f);
 }
 
-void updateGame(int value) {
-  if (game) {
-    game->Update();
+void RenderGame(const GameSnapshot &s) {
+  // Draw seasonal background
+  DrawSeasonalBackground(s.season, s.sky);
+
+  // Draw basket (at bottom)
+  DrawRect(s.basketX, s.basketY, s.basketWidth, s.basketHeight, 0.6f, 0.4f,
+           0.2f);
+
+  // Draw items (falling from top to bottom)
+  for (int i = 0; i < s.itemCount; i++) {
+    const Item &item = s.items[i];
+    DrawRect(item.x, item.y, item.size, item.size, item.r, item.g, item.b,
+             item.a);
   }
-  glutTimerFunc(16, updateGame, 0);
-}
 
-void keyboard(unsigned char key, int x, int y) {
-  if (game) {
-    game->HandleKeyPress(key, x, y);
+  // Draw UI with semi-transparent background (moved to top)
+  DrawRect(5, WINDOW_HEIGHT - 85, 150, 80, 0.0f, 0.0f, 0.0f, 0.5f);
+  DrawText(FrameFormat("Score: %d", s.score), 10, WINDOW_HEIGHT - 70, 1.0f,
+           1.0f, 1.0f);
+  DrawText(FrameFormat("Level: %d", s.level), 10, WINDOW_HEIGHT - 55, 1.0f,
+           1.0f, 1.0f);
+
+  // Draw "Heart" text and hearts
+  DrawText("Heart:", 10, WINDOW_HEIGHT - 45, 1.0f, 1.0f, 1.0f);
+  DrawHearts(s.lives);
+
+  DrawText(FrameFormat("Season: %s", GetSeasonName(s.season)), 10,
+           WINDOW_HEIGHT - 30, 1.0f, 1.0f, 1.0f);
+
+  // Draw Level Up message in center (on top of everything)
+  if (s.showLevelUp) {
+    RenderLevelUpMessage(s);
   }
-}
 
-void keyboardUp(unsigned char key, int x, int y) {
-  if (game) {
-    game->HandleKeyRelease(key, x, y);
+  if (s.paused && !s.gameOver) {
+    DrawRect(WINDOW_WIDTH / 2 - 60, WINDOW_HEIGHT / 2 - 15, 120, 30, 0.0f, 0.0f,
+             0.0f, 0.8f);
+    DrawText("PAUSED", WINDOW_WIDTH / 2 - 30, WINDOW_HEIGHT / 2 - 5, 1.0f,
+             1.0f, 0.0f);
   }
-}
 
-void special(int key, int x, int y) {
-  if (game) {
-    game->HandleSpecialKeyPress(key, x, y);
+  if (s.gameOver) {
+    DrawRect(WINDOW_WIDTH / 2 - 100, WINDOW_HEIGHT / 2 - 50, 200, 100, 0.0f,
+             0.0f, 0.0f, 0.9f);
+    DrawText("GAME OVER", WINDOW_WIDTH / 2 - 45, WINDOW_HEIGHT / 2 - 30, 1.0f,
+             0.0f, 0.0f);
+    DrawText(FrameFormat("Score: %d", s.score), WINDOW_WIDTH / 2 - 40,
+             WINDOW_HEIGHT / 2, 1.0f, 1.0f, 1.0f);
+    DrawText(FrameFormat("Level: %d", s.level), WINDOW_WIDTH / 2 - 40,
+             WINDOW_HEIGHT / 2 + 15, 1.0f, 1.0f, 1.0f);
+    DrawText("Press SPACE to restart", WINDOW_WIDTH / 2 - 80,
+             WINDOW_HEIGHT / 2 + 35, 1.0f, 1.0f, 0.0f);
   }
 }
 
-void specialUp(int key, int x, int y) {
-  if (game) {
-    game->HandleSpecialKeyRelease(key, x, y);
+// ===== Game Scene =====
+// In a window the game simulates on its own thread at a fixed tick so a
+// slow swap or render never delays input or item physics. Key events cross
+// over through a lock-free queue and finished frames come back through the
+// triple buffer. Without a window it ticks in Update like every other
+// scene, so seeded runs repeat exactly.
+
+struct InputEvent {
+  enum Type { KEY_DOWN, KEY_UP, SPECIAL_DOWN, SPECIAL_UP } type;
+  int key;
+};
+
+class GameScene : public Scene {
+public:
+  explicit GameScene(bool bot) : bot(bot) {}
+  ~GameScene() override { StopSimulation(); }
+
+  const char *Name() const override { return "game"; }
+
+  void Enter() override {
+    std::cout << "=== SEASONAL CATCHER ===" << std::endl;
+    std::cout << "Arrow Keys or A/D: Move basket" << std::endl;
+    std::cout << "SPACE: Pause/Resume (or Restart after game over)"
+              << std::endl;
+    std::cout << "N: Switch season manually" << std::endl;
+    std::cout << "L: Level up manually (for testing)" << std::endl;
+    std::cout << "ESC: Exit game" << std::endl;
+    std::cout << "\nCatch good items (+10 points)" << std::endl;
+    std::cout << "Avoid bad items (-1 life)" << std::endl;
+    std::cout << "Seasons progression:" << std::endl;
+    std::cout << "  Spring (0-49): Catch pink cherry blossoms" << std::endl;
+    std::cout << "  Summer (50-99): Catch bright yellow fruits" << std::endl;
+    std::cout << "  Autumn (100-149): Catch orange/red leaves" << std::endl;
+    std::cout << "  Winter (150-199): Catch white snowflakes" << std::endl;
+    std::cout << "  Complete all seasons (reach 200) to level up!" << std::endl;
+    std::cout << "  Each level: 2x faster items!" << std::endl;
+    std::cout << "\nGood luck!" << std::endl;
+
+    // Publish a first frame before the thread exists so Render always has one
+    game.Snapshot(snapshots.WriteBuffer());
+    snapshots.Publish();
+    snapshots.Update();
+
+    if (RealTimeSimulation()) {
+      running.store(true);
+      simulation = std::thread(&GameScene::SimulationLoop, this);
+    }
   }
-}
 
-void initGL() {
-  glClearColor(0.46f, 0.92f, 0.96f, 1.0f);
-  glMatrixMode(GL_PROJECTION);
-  glLoadIdentity();
-  gluOrtho2D(0, WINDOW_WIDTH, 0, WINDOW_HEIGHT);
-  glMatrixMode(GL_MODELVIEW);
-  glEnable(GL_BLEND);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-  // Initialize snowflakes
-  for (int i = 0; i < 100; i++)
-    snowflakes.push_back({(float)(rand() % WINDOW_WIDTH),
-                          (float)(rand() % WINDOW_HEIGHT), 2 + rand() % 3});
-
-  // Initialize clouds
-  for (int i = 0; i < 3; i++)
-    cloudX[i] = rand() % WINDOW_WIDTH;
-}
+  void Exit() override { StopSimulation(); }
 
-int main(int argc, char **argv) {
-  glutInit(&argc, argv);
-  glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB);
-  glutInitWindowSize(WINDOW_WIDTH, WINDOW_HEIGHT);
-  glutInitWindowPosition(100, 100);
-  glutCreateWindow("Seasonal Catcher with Animated Background");
-
-  initGL();
-
-  game = new Game();
-
-  glutDisplayFunc(display);
-  glutKeyboardFunc(keyboard);
-  glutKeyboardUpFunc(keyboardUp);
-  glutSpecialFunc(special);
-  glutSpecialUpFunc(specialUp);
-  glutTimerFunc(0, updateScene, 0);
-  glutTimerFunc(0, updateGame, 0);
-
-  std::cout << "=== SEASONAL CATCHER ===" << std::endl;
-  std::cout << "Arrow Keys or A/D: Move basket" << std::endl;
-  std::cout << "SPACE: Pause/Resume (or Restart after game over)" << std::endl;
-  std::cout << "N: Switch season manually" << std::endl;
-  std::cout << "L: Level up manually (for testing)" << std::endl;
-  std::cout << "ESC: Exit game" << std::endl;
-  std::cout << "\nCatch good items (+10 points)" << std::endl;
-  std::cout << "Avoid bad items (-1 life)" << std::endl;
-  std::cout << "Seasons progression:" << std::endl;
-  std::cout << "  Spring (0-49): Catch pink cherry blossoms" << std::endl;
-  std::cout << "  Summer (50-99): Catch bright yellow fruits" << std::endl;
-  std::cout << "  Autumn (100-149): Catch orange/red leaves" << std::endl;
-  std::cout << "  Winter (150-199): Catch white snowflakes" << std::endl;
-  std::cout << "  Complete all seasons (reach 200) to level up!" << std::endl;
-  std::cout << "  Each level: 2x faster items!" << std::endl;
-  std::cout << "\nGood luck!" << std::endl;
-
-  glutMainLoop();
-
-  delete game;
-  return 0;
-}
+  // A simulation thread keeps its own clock
+  void Update(float /*dt*/) override {
+    if (simulation.joinable())
+      return;
+    Tick();
+    Publish();
+    live.store(!RenderOnDemand() || game.IsLive() || bot,
+               std::memory_order_release);
+  }
+
+  // Each published snapshot invalidates the window; once paused or over,
+  // the simulation sleeps and nothing changes until a key is pressed
+  Activity CurrentActivity() const override {
+    return live.load(std::memory_order_acquire) ? TIMED : STILL;
+  }
+
+  void Render() override {
+    snapshots.Update();
+    RenderGame(snapshots.Read());
+  }
+
+  void HandleKeyPress(unsigned char key, int /*x*/, int /*y*/) override {
+    if (key == 27) // ESC key
+      exit(0);
+    Send(InputEvent::KEY_DOWN, key);
+  }
+
+  void HandleKeyRelease(unsigned char key, int /*x*/, int /*y*/) override {
+    Send(InputEvent::KEY_UP, key);
+  }
+
+  void HandleSpecialKeyPress(int key, int /*x*/, int /*y*/) override {
+    Send(InputEvent::SPECIAL_DOWN, key);
+  }
+
+  void HandleSpecialKeyRelease(int key, int /*x*/, int /*y*/) override {
+    Send(InputEvent::SPECIAL_UP, key);
+  }
+
+private:
+  void Send(InputEvent::Type type, int key) {
+    // A full queue means the simulation has stalled; dropping is harmless
+    input.Push({type, key});
+    {
+      std::lock_guard<std::mutex> lock(wakeMutex);
+      inputArrived = true;
+    }
+    wake.notify_one();
+  }
+
+  void Apply(const InputEvent &event) {
+    switch (event.type) {
+    case InputEvent::KEY_DOWN:
+      game.HandleKeyPress((unsigned char)event.key, 0, 0);
+      break;
+    case InputEvent::KEY_UP:
+      game.HandleKeyRelease((unsigned char)event.key, 0, 0);
+      break;
+    case InputEvent::SPECIAL_DOWN:
+      game.HandleSpecialKeyPress(event.key, 0, 0);
+      break;
+    case InputEvent::SPECIAL_UP:
+      game.HandleSpecialKeyRelease(event.key, 0, 0);
+      break;
+    }
+  }
+
+  void Tick() {
+    InputEvent event;
+    while (input.Pop(event))
+      Apply(event);
+
+    if (bot)
+      game.Autoplay();
+
+    // On demand, a paused game keeps its scenery still too
+    if (!RenderOnDemand() || game.IsLive())
+      game.UpdateScenery(kTickSeconds);
+    game.Update(kTickSeconds);
+  }
+
+  void Publish() {
+    game.Snapshot(snapshots.WriteBuffer());
+    snapshots.Publish();
+    Invalidate();
+  }
+
+  void SimulationLoop() {
+    FramePacer pacer(kTickSeconds);
+    while (running.load(std::memory_order_acquire)) {
+      // Catch up after short hiccups, but don't replay a long stall
+      int ticks = pacer.Wait() * SimulationSpeed();
+      for (int i = 0; i < ticks; i++)
+        Tick();
+      Publish();
+
+      // A bot restarts a finished game itself on the next tick
+      if (RenderOnDemand() && !game.IsLive() && !bot) {
+        live.store(false, std::memory_order_release);
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wake.wait(lock, [this] {
+          return inputArrived || !running.load(std::memory_order_acquire);
+        });
+        inputArrived = false;
+        lock.unlock();
+        pacer.Resume();
+      }
+      live.store(true, std::memory_order_release);
+    }
+  }
+
+  void StopSimulation() {
+    running.store(false, std::memory_order_release);
+    {
+      std::lock_guard<std::mutex> lock(wakeMutex);
+    }
+    wake.notify_one();
+    if (simulation.joinable())
+      simulation.join();
+  }
+
+  Game game; // owned by the simulation thread while one runs
+  bool bot;  // the game plays itself
+  TripleBuffer<GameSnapshot> snapshots;
+  SpscQueue<InputEvent, 256> input;
+  std::atomic<bool> running{false};
+  std::atomic<bool> live{true};
+  std::thread simulation;
+
+  // Wakes a simulation that is waiting for input
+  std::mutex wakeMutex;
+  std::condition_variable wake;
+  bool inputArrived = false;
+};
+
+Scene *CreateGameScene(bool bot) { return new GameScene(bot); }
@@ -0,0 +1,21 @@
+// Season Catcher's rules: basket and item sizes, speeds, scoring. Shared by
+// the playable game and the batch environment the bots train in, so both
+// play exactly the same game.
+#ifndef GAME_RULES_H
+#define GAME_RULES_H
+
+const float BASKET_SPEED = 300.0f;
+const float BASKET_WIDTH = 100.0f;
+const float BASKET_HEIGHT = 60.0f;
+const float BASKET_Y = 20.0f; // Near the bottom
+
+const float ITEM_SIZE = 40.0f;
+const float BASE_ITEM_FALL_SPEED = 100.0f;
+const float BASE_ITEM_SPAWN_INTERVAL = 1.5f;
+const int GOOD_ITEM_CHANCE = 70; // percent
+
+const int STARTING_LIVES = 3;
+const int ITEM_POINTS = 10;
+const int LEVEL_UP_SCORE = 200; // Complete all seasons
+
+#endif
@@ -0,0 +1,996 @@
+#define GL_GLEXT_PROTOTYPES
+#include "render_backend.h"
+
+#include "bitmap_font.h"
+#include "draw_list.h"
+#include "engine.h"
+#include "gl_shaders.h"
+
+#include <GL/glext.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+// Frames in flight between glReadPixels and mapping the result
+const int kReadbackSlots = 3;
+
+// Vertices of every flush are appended to one long-lived buffer, which is
+// only reallocated once it is full
+const size_t kStreamBytes = 4 << 20;
+
+// In window pixels; the slack Mesa's glBitmap allows its raster position
+const float kSnapEpsilon = 1e-4f;
+
+struct Readback {
+  GLuint buffer = 0;
+  GLsync fence = nullptr;
+};
+
+const char *const kVersion = "#version 330 core\n";
+
+// Every program maps layout units to clip space through projection, the
+// scale then the offset of the current orthographic projection
+const char *kSolidVertexShader = R"(
+uniform vec4 projection;
+layout(location = 0) in vec2 position;
+layout(location = 2) in vec4 color;
+out vec4 tint;
+void main() {
+  tint = color;
+  gl_Position = vec4(position * projection.xy + projection.zw, 0.0, 1.0);
+}
+)";
+
+const char *kSolidFragmentShader = R"(
+in vec4 tint;
+out vec4 fragColor;
+void main() {
+  fragColor = tint;
+}
+)";
+
+// Circles, bowls and hearts as quads, with their position in shape units
+// and the shape kind
+const char *kShapeVertexShader = R"(
+uniform vec4 projection;
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec3 shape;
+layout(location = 2) in vec4 color;
+out vec3 shapePosition;
+out vec4 tint;
+void main() {
+  shapePosition = shape;
+  tint = color;
+  gl_Position = vec4(position * projection.xy + projection.zw, 0.0, 1.0);
+}
+)";
+
+// Palette meshes: solid triangles (kind 3) and circle quads, the palette
+// index riding along with the shape position and kind
+const char *kMeshVertexShader = R"(
+uniform vec4 projection;
+uniform vec4 palette[16]; // kMaxPaletteColors
+uniform vec2 offset;
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec4 shape;
+out vec3 shapePosition;
+out vec4 tint;
+void main() {
+  shapePosition = shape.xyz;
+  tint = palette[int(shape.w)];
+  gl_Position = vec4((position + offset) * projection.xy + projection.zw,
+                     0.0, 1.0);
+}
+)";
+
+const char *kShapeFragmentShader = R"(
+in vec3 shapePosition;
+in vec4 tint;
+out vec4 fragColor;
+void main() {
+  fragColor = vec4(tint.rgb, tint.a * shapeCoverage(shapePosition));
+}
+)";
+
+const char *kTexturedVertexShader = R"(
+uniform vec4 projection;
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec2 uv;
+layout(location = 2) in vec4 color;
+out vec2 texCoord;
+out vec4 tint;
+void main() {
+  texCoord = uv;
+  tint = color;
+  gl_Position = vec4(position * projection.xy + projection.zw, 0.0, 1.0);
+}
+)";
+
+// Images are tinted like fixed-function GL_MODULATE
+const char *kTexturedFragmentShader = R"(
+uniform sampler2D image;
+in vec2 texCoord;
+in vec4 tint;
+out vec4 fragColor;
+void main() {
+  fragColor = texture(image, texCoord) * tint;
+}
+)";
+
+// Glyph atlases hold coverage in the red channel
+const char *kTextFragmentShader = R"(
+uniform sampler2D image;
+in vec2 texCoord;
+in vec4 tint;
+out vec4 fragColor;
+void main() {
+  fragColor = vec4(tint.rgb, tint.a * texture(image, texCoord).r);
+}
+)";
+
+const char *kSkyVertexShader = R"(
+uniform vec4 projection;
+layout(location = 0) in vec2 position;
+out vec2 windowPosition; // window pixels, whatever the viewport
+void main() {
+  windowPosition = position;
+  gl_Position = vec4(position * projection.xy + projection.zw, 0.0, 1.0);
+}
+)";
+
+const char *kSkyFragmentShader = R"(
+in vec2 windowPosition;
+out vec4 fragColor;
+void main() {
+  fragColor = vec4(sky(windowPosition), 1.0);
+}
+)";
+
+struct ShapeVertex {
+  float x, y;
+  float shapeX, shapeY, kind;
+  float r, g, b, a;
+};
+
+const float kSolidKind = 3;
+
+struct MeshVertex {
+  float x, y;
+  float shapeX, shapeY, kind, color;
+};
+
+// Consecutive vertices of one palette color
+struct MeshRun {
+  int color, first, count;
+};
+
+struct Mesh {
+  GLuint buffer, vertexArray;
+  std::vector<MeshRun> runs;
+  DrawBounds bounds; // before the draw's offset
+};
+
+struct TexturedVertex {
+  float x, y, u, v;
+  float r, g, b, a;
+};
+
+// One per material kind, in the order draws sort by within a layer
+enum Program {
+  PROGRAM_SOLID,
+  PROGRAM_SHAPES,
+  PROGRAM_TEXTURED,
+  PROGRAM_TEXT,
+  PROGRAM_MESH,
+  PROGRAM_SKY,
+  PROGRAM_COUNT
+};
+
+enum CommandType {
+  COMMAND_VERTICES, // solid triangles and shape quads in vertices
+  COMMAND_TEXTURED, // image and glyph triangles in texturedVertices
+  COMMAND_MESH,     // meshDraws[first]
+  COMMAND_SKY       // skies[first]
+};
+
+struct Command {
+  CommandType type;
+  int first, count;
+  GLuint texture;
+};
+
+struct MeshDraw {
+  int mesh;
+  float x, y;
+  float palette[kMaxPaletteColors * 4];
+  int colors;
+};
+
+// A bitmap font's glyphs in one single-channel texture, 16 x 16 cells of
+// the widest advance by the font height. Core profiles have no glBitmap,
+// so all text is drawn from these.
+struct GlyphAtlas {
+  const BitmapFont *font;
+  GLuint texture;
+  int cellWidth;
+};
+
+// An orthographic projection as the scale and offset to clip space
+struct Projection {
+  float scale[2], offset[2];
+};
+
+Projection Ortho(float left, float right, float bottom, float top) {
+  return {{2 / (right - left), 2 / (top - bottom)},
+          {-(right + left) / (right - left), -(top + bottom) / (top - bottom)}};
+}
+
+const DrawBounds kEverywhere = {-1e30f, -1e30f, 1e30f, 1e30f};
+
+template <typename Vertex> DrawBounds BoundsOf(const Vertex *v, int count) {
+  DrawBounds bounds = {v->x, v->y, v->x, v->y};
+  for (int i = 1; i < count; i++) {
+    bounds.left = std::min(bounds.left, v[i].x);
+    bounds.right = std::max(bounds.right, v[i].x);
+    bounds.bottom = std::min(bounds.bottom, v[i].y);
+    bounds.top = std::max(bounds.top, v[i].y);
+  }
+  return bounds;
+}
+
+void Attribute(GLuint index, int size, GLsizei stride, size_t offset) {
+  glEnableVertexAttribArray(index);
+  glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride,
+                        (const void *)offset);
+}
+
+// The GL 3.3 core profile: no fixed-function pipeline, immediate mode,
+// client arrays or matrix stack. Draws are recorded and sorted exactly as
+// in gl_renderer.cpp, then submitted from vertex buffers through one
+// program per material.
+class GL33Renderer : public RenderBackend {
+public:
+  explicit GL33Renderer(bool skyShader) : skyShader(skyShader) {
+    projections.push_back(Ortho(0, WINDOW_WIDTH, 0, WINDOW_HEIGHT));
+    pixelSizes.push_back({1.0f, 1.0f});
+  }
+
+  // Builds the programs and buffers; false if the context cannot run them
+  bool Init() {
+    struct Source {
+      const char *name, *vertex, *fragment, *library;
+    };
+    const Source sources[PROGRAM_COUNT] = {
+        {"Solid", kSolidVertexShader, kSolidFragmentShader, ""},
+        {"Shape", kShapeVertexShader, kShapeFragmentShader, kShapeLibrary},
+        {"Textured", kTexturedVertexShader, kTexturedFragmentShader, ""},
+        {"Text", kTexturedVertexShader, kTextFragmentShader, ""},
+        {"Mesh", kMeshVertexShader, kShapeFragmentShader, kShapeLibrary},
+        {"Sky", kSkyVertexShader, kSkyFragmentShader, kSkyLibrary}};
+    for (int i = 0; i < PROGRAM_COUNT; i++) {
+      const Source &source = sources[i];
+      GLuint id = BuildProgram(source.name, kVersion, source.vertex,
+                               source.fragment, source.library);
+      if (!id)
+        return false;
+      programs[i].id = id;
+      programs[i].projection = glGetUniformLocation(id, "projection");
+    }
+
+    glUseProgram(programs[PROGRAM_SHAPES].id);
+    glUniform2fv(glGetUniformLocation(programs[PROGRAM_SHAPES].id,
+                                      "heartOutline"),
+                 kHeartOutlinePoints, HeartOutline());
+    GLuint mesh = programs[PROGRAM_MESH].id;
+    glUseProgram(mesh);
+    glUniform2fv(glGetUniformLocation(mesh, "heartOutline"),
+                 kHeartOutlinePoints, HeartOutline());
+    meshUniforms.palette = glGetUniformLocation(mesh, "palette");
+    meshUniforms.offset = glGetUniformLocation(mesh, "offset");
+    GLuint sky = programs[PROGRAM_SKY].id;
+    skyUniforms.skyColor = glGetUniformLocation(sky, "skyColor");
+    skyUniforms.groundColor = glGetUniformLocation(sky, "groundColor");
+    skyUniforms.horizon = glGetUniformLocation(sky, "horizon");
+    skyUniforms.sunVisible = glGetUniformLocation(sky, "sunVisible");
+    skyUniforms.sunX = glGetUniformLocation(sky, "sunX");
+    skyUniforms.sunCurve = glGetUniformLocation(sky, "sunCurve");
+    skyUniforms.cloudCount = glGetUniformLocation(sky, "cloudCount");
+    skyUniforms.clouds = glGetUniformLocation(sky, "clouds");
+    glUseProgram(0);
+
+    glGenBuffers(1, &streamBuffer);
+    glGenVertexArrays(1, &shapeArray);
+    glGenVertexArrays(1, &texturedArray);
+
+    // The sky is one full-window quad that never changes
+    const float w = WINDOW_WIDTH, h = WINDOW_HEIGHT;
+    const float quad[12] = {0, 0, w, 0, w, h, 0, 0, w, h, 0, h};
+    glGenVertexArrays(1, &skyArray);
+    glBindVertexArray(skyArray);
+    glGenBuffers(1, &skyBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, skyBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    Attribute(0, 2, 2 * sizeof(float), 0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // What initGL sets up for the legacy path
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    return true;
+  }
+
+  const char *Name() const override { return "gl33"; }
+
+  void BeginFrame(float r, float g, float b) override {
+    // The window may be drawn larger or smaller than the virtual screen
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    viewportWidth = std::max(viewport[2], 1);
+    viewportHeight = std::max(viewport[3], 1);
+    pixelSizes.assign(1, {WINDOW_WIDTH / (float)viewportWidth,
+                          WINDOW_HEIGHT / (float)viewportHeight});
+    projections.resize(1);
+    projectionStamp++;
+    glClearColor(r, g, b, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+  }
+
+  void EndFrame() override {
+    Flush();
+    lastStats = stats;
+    stats = DrawStats();
+  }
+
+  DrawStats LastDrawStats() const override { return lastStats; }
+
+  // Bounds are compared in the units they were recorded in, so the list is
+  // drawn out before every projection change
+  void PushProjection(float left, float right, float bottom,
+                      float top) override {
+    Flush();
+    pixelSizes.push_back(
+        {(right - left) / viewportWidth, (top - bottom) / viewportHeight});
+    projections.push_back(Ortho(left, right, bottom, top));
+    projectionStamp++;
+  }
+
+  void PopProjection() override {
+    Flush();
+    if (pixelSizes.size() > 1) {
+      pixelSizes.pop_back();
+      projections.pop_back();
+    }
+    projectionStamp++;
+  }
+
+  // Recorded as triangles, so consecutive solids share one draw call
+  void FillPrimitive(Primitive primitive, const float *xy, int count, float r,
+                     float g, float b, float a) override {
+    int first = (int)vertices.size();
+    auto vertex = [&](int i) {
+      vertices.push_back(
+          {xy[i * 2], xy[i * 2 + 1], 0, 0, kSolidKind, r, g, b, a});
+    };
+    if (primitive == PRIM_TRIANGLES) {
+      for (int i = 0; i + 2 < count; i += 3)
+        for (int k = 0; k < 3; k++)
+          vertex(i + k);
+    } else if (primitive == PRIM_TRIANGLE_FAN) {
+      for (int i = 1; i + 1 < count; i++) {
+        vertex(0);
+        vertex(i);
+        vertex(i + 1);
+      }
+    } else {
+      for (int i = 0; i + 3 < count; i += 4) {
+        const int corners[6] = {0, 1, 2, 0, 2, 3};
+        for (int k : corners)
+          vertex(i + k);
+      }
+    }
+    AddVertices(first, PROGRAM_SOLID);
+  }
+
+  GLuint CreateTexture(const Image &image) override {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, image.width, image.height, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data());
+    glBindTexture(GL_TEXTURE_2D, currentTexture);
+    return texture;
+  }
+
+  void DrawTexture(GLuint texture, float x, float y, float w,
+                   float h) override {
+    int first = (int)texturedVertices.size();
+    AddQuad(x, y, w, h, 0, 0, 1, 1, 1, 1, 1);
+    AddTextured(texture, first, PROGRAM_TEXTURED);
+  }
+
+  // Glyph quads sized in virtual screen pixels. At the virtual screen's
+  // own size they land on whole pixels, where glBitmap would put them.
+  void DrawText(const char *text, int length, float x, float y, void *font,
+                float r, float g, float b) override {
+    const BitmapFont &bitmapFont = GetBitmapFont(font);
+    float unitX = pixelSizes.back().first * viewportWidth / WINDOW_WIDTH;
+    float unitY = pixelSizes.back().second * viewportHeight / WINDOW_HEIGHT;
+    float left = x - bitmapFont.xorig * unitX;
+    float bottom = y - bitmapFont.yorig * unitY;
+    if (viewportWidth == WINDOW_WIDTH && viewportHeight == WINDOW_HEIGHT) {
+      left = SnapToPixel(left, 0, viewportWidth);
+      bottom = SnapToPixel(bottom, 1, viewportHeight);
+    }
+    float height = bitmapFont.height * unitY;
+
+    const GlyphAtlas &atlas = AtlasFor(bitmapFont);
+    int first = (int)texturedVertices.size();
+    const float cell = 1.0f / 16;
+    for (int i = 0; i < length; i++) {
+      unsigned char c = text[i];
+      int advance = bitmapFont.Advance(c);
+      float width = advance * unitX;
+      AddQuad(left, bottom, width, height, (c % 16) * cell, (c / 16) * cell,
+              advance / (16.0f * atlas.cellWidth), cell, r, g, b);
+      left += width;
+    }
+    AddTextured(atlas.texture, first, PROGRAM_TEXT);
+  }
+
+  bool DrawSky(const SkyLayer &sky) override {
+    if (!skyShader)
+      return false;
+    skies.push_back(sky);
+    Add({COMMAND_SKY, (int)skies.size() - 1, 1, 0},
+        DrawState(PROGRAM_SKY, 0, 0), kEverywhere);
+    return true;
+  }
+
+  // Four corners per shape whatever its size, as two triangles. The quad is
+  // grown by a pixel so the antialiased rim is not clipped.
+  bool FillShape(Shape shape, float x, float y, float size, float r, float g,
+                 float b, float a) override {
+    if (size <= 0)
+      return true;
+
+    float left = -1, right = 1, bottom = -1, top = 1;
+    if (shape == SHAPE_BOWL)
+      top = 0;
+    else if (shape == SHAPE_HEART) {
+      left = -16;
+      right = 16;
+      bottom = -12;
+      top = 17;
+    }
+    float growX = pixelSizes.back().first / size;
+    float growY = pixelSizes.back().second / size;
+    left -= growX;
+    right += growX;
+    bottom -= growY;
+    top += growY;
+
+    int first = (int)vertices.size();
+    const float corners[6][2] = {{left, bottom}, {right, bottom},
+                                 {right, top},   {left, bottom},
+                                 {right, top},   {left, top}};
+    for (const float *corner : corners)
+      vertices.push_back({x + corner[0] * size, y + corner[1] * size,
+                          corner[0], corner[1], (float)shape, r, g, b, a});
+    AddVertices(first, PROGRAM_SHAPES);
+    return true;
+  }
+
+  // Each mesh keeps its own buffer and vertex array; circles become quads
+  // grown by a window pixel, like FillShape's
+  int CreateMesh(const MeshPart *parts, int count) override {
+    Mesh mesh = {0, 0, {}, kEverywhere};
+    std::vector<MeshVertex> vertices;
+    for (int i = 0; i < count; i++) {
+      const MeshPart &part = parts[i];
+      const float *v = part.xy;
+      float color = (float)part.color;
+      if (mesh.runs.empty() || mesh.runs.back().color != part.color)
+        mesh.runs.push_back({part.color, (int)vertices.size(), 0});
+      mesh.runs.back().count += part.circle ? 6 : 3;
+      if (!part.circle) {
+        for (int k = 0; k < 3; k++)
+          vertices.push_back(
+              {v[k * 2], v[k * 2 + 1], 0, 0, kSolidKind, color});
+        continue;
+      }
+      float edge = 1 + 1 / v[2];
+      const float corners[6][2] = {{-edge, -edge}, {edge, -edge},
+                                   {edge, edge},   {-edge, -edge},
+                                   {edge, edge},   {-edge, edge}};
+      for (const float *corner : corners)
+        vertices.push_back({v[0] + corner[0] * v[2], v[1] + corner[1] * v[2],
+                            corner[0], corner[1], (float)SHAPE_CIRCLE,
+                            color});
+    }
+    if (!vertices.empty())
+      mesh.bounds = BoundsOf(vertices.data(), (int)vertices.size());
+
+    glGenVertexArrays(1, &mesh.vertexArray);
+    glBindVertexArray(mesh.vertexArray);
+    glGenBuffers(1, &mesh.buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.buffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex),
+                 vertices.data(), GL_STATIC_DRAW);
+    Attribute(0, 2, sizeof(MeshVertex), offsetof(MeshVertex, x));
+    Attribute(1, 4, sizeof(MeshVertex), offsetof(MeshVertex, shapeX));
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    // A destroyed mesh's slot is given out again
+    for (size_t i = 0; i < meshes.size(); i++)
+      if (!meshes[i].buffer) {
+        meshes[i] = mesh;
+        return (int)i + 1;
+      }
+    meshes.push_back(mesh);
+    return (int)meshes.size();
+  }
+
+  // Draws already queued from the mesh are drawn out first
+  void DestroyMesh(int handle) override {
+    if (handle <= 0 || handle > (int)meshes.size() ||
+        !meshes[handle - 1].buffer)
+      return;
+    Flush();
+    Mesh &mesh = meshes[handle - 1];
+    glDeleteBuffers(1, &mesh.buffer);
+    glDeleteVertexArrays(1, &mesh.vertexArray);
+    mesh = {0, 0, {}, kEverywhere};
+  }
+
+  bool DrawMesh(int handle, float x, float y, const float *palette,
+                int colors) override {
+    if (handle <= 0 || handle > (int)meshes.size() ||
+        !meshes[handle - 1].buffer)
+      return false;
+    const Mesh &mesh = meshes[handle - 1];
+    MeshDraw draw = {handle, x, y, {}, std::min(colors, kMaxPaletteColors)};
+    std::copy(palette, palette + draw.colors * 4, draw.palette);
+    meshDraws.push_back(draw);
+    const DrawBounds &b = mesh.bounds;
+    Add({COMMAND_MESH, (int)meshDraws.size() - 1, 1, 0},
+        DrawState(PROGRAM_MESH, mesh.buffer, 0),
+        {b.left + x, b.bottom + y, b.right + x, b.top + y});
+    return true;
+  }
+
+  void ReadFrame(std::vector<unsigned char> &rgba) override {
+    Flush();
+    rgba.resize(WINDOW_WIDTH * WINDOW_HEIGHT * 4);
+    ReadPixels(rgba.data());
+  }
+
+  // glReadPixels into a pixel buffer object returns immediately; the copy
+  // is mapped a few frames later, once its fence says the GPU is done
+  void QueueReadback() override {
+    Flush();
+    if (!readbacks[0].buffer) {
+      for (Readback &slot : readbacks) {
+        glGenBuffers(1, &slot.buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, WINDOW_WIDTH * WINDOW_HEIGHT * 4,
+                     nullptr, GL_STREAM_READ);
+      }
+    }
+    if (readbackCount == kReadbackSlots)
+      return; // the caller skipped TakeReadback; drop rather than overwrite
+
+    Readback &slot =
+        readbacks[(readbackFirst + readbackCount) % kReadbackSlots];
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    ReadPixels(nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    readbackCount++;
+  }
+
+  bool TakeReadback(std::vector<unsigned char> &rgba, bool wait) override {
+    if (readbackCount == 0)
+      return false;
+    Readback &slot = readbacks[readbackFirst];
+    if (!wait && readbackCount < kReadbackSlots &&
+        glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+      return false;
+    glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                     GL_TIMEOUT_IGNORED);
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    rgba.resize(WINDOW_WIDTH * WINDOW_HEIGHT * 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (const void *pixels = glMapBufferRange(
+            GL_PIXEL_PACK_BUFFER, 0, rgba.size(), GL_MAP_READ_BIT)) {
+      memcpy(rgba.data(), pixels, rgba.size());
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readbackFirst = (readbackFirst + 1) % kReadbackSlots;
+    readbackCount--;
+    return true;
+  }
+
+private:
+  struct ProgramState {
+    GLuint id = 0;
+    GLint projection = -1;
+    int stamp = -1; // projectionStamp when projection was last set
+  };
+
+  void Add(const Command &command, uint64_t state, const DrawBounds &bounds) {
+    commands.push_back(command);
+    drawList.Add(state, bounds, (int)commands.size() - 1);
+  }
+
+  // The vertices recorded since first, as one command
+  void AddVertices(int first, Program program) {
+    int count = (int)vertices.size() - first;
+    if (count == 0)
+      return;
+    Add({COMMAND_VERTICES, first, count, 0}, DrawState(program, 0, 0),
+        BoundsOf(&vertices[first], count));
+  }
+
+  // Two triangles; there are no quads in the core profile
+  void AddQuad(float x, float y, float w, float h, float u, float v,
+               float du, float dv, float r, float g, float b) {
+    const TexturedVertex corners[4] = {
+        {x, y, u, v, r, g, b, 1},
+        {x + w, y, u + du, v, r, g, b, 1},
+        {x + w, y + h, u + du, v + dv, r, g, b, 1},
+        {x, y + h, u, v + dv, r, g, b, 1}};
+    const int order[6] = {0, 1, 2, 0, 2, 3};
+    for (int k : order)
+      texturedVertices.push_back(corners[k]);
+  }
+
+  // The triangles recorded since first, as one command
+  void AddTextured(GLuint texture, int first, Program program) {
+    int count = (int)texturedVertices.size() - first;
+    if (count == 0)
+      return;
+    Add({COMMAND_TEXTURED, first, count, texture},
+        DrawState(program, texture, 0),
+        BoundsOf(&texturedVertices[first], count));
+  }
+
+  // Stream writes start on 256-byte boundaries
+  static size_t StreamAligned(size_t bytes) {
+    return (bytes + 255) & ~(size_t)255;
+  }
+
+  // Makes room for bytes of writes at the end of the stream buffer. A full
+  // buffer is reallocated, when the driver hands over fresh storage and
+  // frees the old once the draws reading it are done, so ranges are never
+  // rewritten and the writes need no synchronization. Everything a flush
+  // streams is reserved at once: reallocating between its writes would
+  // leave the arrays set up from the earlier ones reading freed storage.
+  void ReserveStream(size_t bytes) {
+    glBindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+    if (streamUsed + bytes > streamSize) {
+      streamSize = std::max(streamSize, std::max(kStreamBytes, bytes * 2));
+      glBufferData(GL_ARRAY_BUFFER, streamSize, nullptr, GL_STREAM_DRAW);
+      streamUsed = 0;
+    }
+  }
+
+  // Copies data into room made by ReserveStream and returns its offset
+  size_t Stream(const void *data, size_t bytes) {
+    void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, streamUsed, bytes,
+                                    GL_MAP_WRITE_BIT |
+                                        GL_MAP_INVALIDATE_RANGE_BIT |
+                                        GL_MAP_UNSYNCHRONIZED_BIT);
+    memcpy(mapped, data, bytes);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    size_t offset = streamUsed;
+    streamUsed += StreamAligned(bytes);
+    return offset;
+  }
+
+  // Uploads the frame's vertices and points the vertex arrays at them
+  void StreamVertices() {
+    size_t shapeBytes = vertices.size() * sizeof(ShapeVertex);
+    size_t texturedBytes = texturedVertices.size() * sizeof(TexturedVertex);
+    if (shapeBytes + texturedBytes == 0)
+      return;
+    ReserveStream(StreamAligned(shapeBytes) + StreamAligned(texturedBytes));
+    if (shapeBytes) {
+      size_t base = Stream(vertices.data(), shapeBytes);
+      glBindVertexArray(shapeArray);
+      Attribute(0, 2, sizeof(ShapeVertex), base + offsetof(ShapeVertex, x));
+      Attribute(1, 3, sizeof(ShapeVertex),
+                base + offsetof(ShapeVertex, shapeX));
+      Attribute(2, 4, sizeof(ShapeVertex), base + offsetof(ShapeVertex, r));
+    }
+    if (texturedBytes) {
+      size_t base = Stream(texturedVertices.data(), texturedBytes);
+      glBindVertexArray(texturedArray);
+      Attribute(0, 2, sizeof(TexturedVertex),
+                base + offsetof(TexturedVertex, x));
+      Attribute(1, 2, sizeof(TexturedVertex),
+                base + offsetof(TexturedVertex, u));
+      Attribute(2, 4, sizeof(TexturedVertex),
+                base + offsetof(TexturedVertex, r));
+    }
+    currentArray = 0; // whichever was bound last is no longer known
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+
+  // Draws the recorded commands in sorted order. A run of commands with the
+  // same state goes out as one call, and state is only set when it changes.
+  void Flush() {
+    if (drawList.Empty())
+      return;
+    const std::vector<DrawList::Entry> &order = drawList.Sort();
+    stats.commands += (int)order.size();
+    stats.stateChanges += drawList.SortedChanges();
+    stats.unsortedChanges += drawList.RecordedChanges();
+    StreamVertices();
+
+    for (size_t begin = 0, end; begin < order.size(); begin = end) {
+      end = begin + 1;
+      while (end < order.size() && order[end].state == order[begin].state)
+        end++;
+      UseProgram((Program)DrawStateProgram(order[begin].state));
+      switch (commands[order[begin].payload].type) {
+      case COMMAND_VERTICES:
+        UseArray(shapeArray);
+        SubmitRanges(order, begin, end);
+        break;
+      case COMMAND_TEXTURED:
+        UseArray(texturedArray);
+        UseTexture(commands[order[begin].payload].texture);
+        SubmitRanges(order, begin, end);
+        break;
+      case COMMAND_MESH:
+        SubmitMeshes(order, begin, end);
+        break;
+      case COMMAND_SKY:
+        SubmitSkies(order, begin, end);
+        break;
+      }
+    }
+    glUseProgram(0);
+    glBindVertexArray(0);
+    currentProgram = -1;
+    currentArray = 0;
+
+    drawList.Clear();
+    commands.clear();
+    vertices.clear();
+    texturedVertices.clear();
+    meshDraws.clear();
+    skies.clear();
+  }
+
+  // Moves a coordinate on axis 0 (x) or 1 (y) down to the nearest pixel
+  // edge of the viewport, through the current projection. Like Mesa's
+  // glBitmap, a hair below an edge counts as on it, so rounding error in
+  // the projection doesn't drop text a pixel.
+  float SnapToPixel(float value, int axis, int pixels) const {
+    const Projection &projection = projections.back();
+    float clip = value * projection.scale[axis] + projection.offset[axis];
+    float pixel = std::floor((clip + 1) * 0.5f * pixels + kSnapEpsilon);
+    return ((pixel / pixels) * 2 - 1 - projection.offset[axis]) /
+           projection.scale[axis];
+  }
+
+  // Sets the program's projection if it has changed since it last ran
+  void UseProgram(Program program) {
+    ProgramState &state = programs[program];
+    if (program != currentProgram)
+      glUseProgram(state.id);
+    currentProgram = program;
+    if (state.stamp != projectionStamp) {
+      const Projection &projection = projections.back();
+      glUniform4f(state.projection, projection.scale[0], projection.scale[1],
+                  projection.offset[0], projection.offset[1]);
+      state.stamp = projectionStamp;
+    }
+  }
+
+  void UseArray(GLuint array) {
+    if (array != currentArray)
+      glBindVertexArray(array);
+    currentArray = array;
+  }
+
+  void UseTexture(GLuint texture) {
+    if (texture != currentTexture)
+      glBindTexture(GL_TEXTURE_2D, texture);
+    currentTexture = texture;
+  }
+
+  // The commands' vertex ranges, with neighbouring ones joined, in one
+  // call on the bound vertex array
+  void SubmitRanges(const std::vector<DrawList::Entry> &order, size_t begin,
+                    size_t end) {
+    rangeFirsts.clear();
+    rangeCounts.clear();
+    for (size_t i = begin; i < end; i++) {
+      const Command &command = commands[order[i].payload];
+      if (!rangeFirsts.empty() &&
+          rangeFirsts.back() + rangeCounts.back() == command.first)
+        rangeCounts.back() += command.count;
+      else {
+        rangeFirsts.push_back(command.first);
+        rangeCounts.push_back(command.count);
+      }
+    }
+    glMultiDrawArrays(GL_TRIANGLES, rangeFirsts.data(), rangeCounts.data(),
+                      (GLsizei)rangeFirsts.size());
+    stats.drawCalls++;
+  }
+
+  // Runs in a transparent color are left out, so a season's missing parts
+  // cost no fill. Only the palette and offset change between draws of one
+  // mesh.
+  void SubmitMeshes(const std::vector<DrawList::Entry> &order, size_t begin,
+                    size_t end) {
+    const Mesh &mesh = meshes[meshDraws[commands[order[begin].payload].first]
+                                  .mesh -
+                              1];
+    UseArray(mesh.vertexArray);
+    for (size_t i = begin; i < end; i++) {
+      const MeshDraw &draw = meshDraws[commands[order[i].payload].first];
+      glUniform4fv(meshUniforms.palette, draw.colors, draw.palette);
+      glUniform2f(meshUniforms.offset, draw.x, draw.y);
+      int first = 0, visible = 0;
+      for (const MeshRun &run : mesh.runs) {
+        if (run.color < draw.colors && draw.palette[run.color * 4 + 3] > 0) {
+          if (visible == 0)
+            first = run.first;
+          visible += run.count;
+          continue;
+        }
+        if (visible > 0) {
+          glDrawArrays(GL_TRIANGLES, first, visible);
+          stats.drawCalls++;
+        }
+        visible = 0;
+      }
+      if (visible > 0) {
+        glDrawArrays(GL_TRIANGLES, first, visible);
+        stats.drawCalls++;
+      }
+    }
+  }
+
+  void SubmitSkies(const std::vector<DrawList::Entry> &order, size_t begin,
+                   size_t end) {
+    UseArray(skyArray);
+    for (size_t i = begin; i < end; i++) {
+      const SkyLayer &sky = skies[commands[order[i].payload].first];
+      glUniform3fv(skyUniforms.skyColor, 1, sky.sky);
+      glUniform3fv(skyUniforms.groundColor, 1, sky.ground);
+      glUniform1f(skyUniforms.horizon, sky.horizon);
+      glUniform1f(skyUniforms.sunVisible, sky.sun ? 1.0f : 0.0f);
+      glUniform1f(skyUniforms.sunX, sky.sunX);
+      glUniform3fv(skyUniforms.sunCurve, 1, sky.sunCurve);
+      float clouds[6];
+      for (int k = 0; k < sky.cloudCount; k++) {
+        clouds[k * 2] = sky.cloudX[k];
+        clouds[k * 2 + 1] = sky.cloudY[k];
+      }
+      glUniform1i(skyUniforms.cloudCount, sky.cloudCount);
+      if (sky.cloudCount > 0)
+        glUniform2fv(skyUniforms.clouds, sky.cloudCount, clouds);
+      glDrawArrays(GL_TRIANGLES, 0, 6);
+      stats.drawCalls++;
+    }
+  }
+
+  const GlyphAtlas &AtlasFor(const BitmapFont &font) {
+    for (const GlyphAtlas &atlas : atlases)
+      if (atlas.font == &font)
+        return atlas;
+
+    int cellWidth = 1;
+    for (int c = 0; c < 256; c++)
+      cellWidth = std::max(cellWidth, font.Advance(c));
+    int width = 16 * cellWidth, height = 16 * font.height;
+    std::vector<unsigned char> coverage(width * height, 0);
+    for (int c = 0; c < 256; c++) {
+      int advance = font.Advance(c), stride = (advance + 7) / 8;
+      const unsigned char *rows = font.Rows(c);
+      for (int row = 0; row < font.height; row++)
+        for (int col = 0; col < advance; col++)
+          if (rows[row * stride + col / 8] & (0x80 >> (col % 8)))
+            coverage[((c / 16) * font.height + row) * width +
+                     (c % 16) * cellWidth + col] = 255;
+    }
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED,
+                 GL_UNSIGNED_BYTE, coverage.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, currentTexture);
+    atlases.push_back({&font, texture, cellWidth});
+    return atlases.back();
+  }
+
+  void ReadPixels(void *pixels) {
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+    if (framebuffer == 0) // an offscreen FBO reads its own attachment
+      glReadBuffer(GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels);
+  }
+
+  // Units per framebuffer pixel under each pushed projection
+  std::vector<std::pair<float, float>> pixelSizes;
+  std::vector<Projection> projections;
+  int projectionStamp = 0;
+  int viewportWidth = WINDOW_WIDTH, viewportHeight = WINDOW_HEIGHT;
+
+  // The frame so far, drawn at the next Flush
+  DrawList drawList;
+  std::vector<Command> commands;
+  std::vector<ShapeVertex> vertices;
+  std::vector<TexturedVertex> texturedVertices;
+  std::vector<MeshDraw> meshDraws;
+  std::vector<SkyLayer> skies;
+  std::vector<GLint> rangeFirsts;
+  std::vector<GLsizei> rangeCounts;
+  DrawStats stats, lastStats;
+
+  ProgramState programs[PROGRAM_COUNT];
+  int currentProgram = -1;
+  GLuint currentArray = 0, currentTexture = 0;
+
+  GLuint streamBuffer = 0;
+  size_t streamSize = 0, streamUsed = 0;
+  GLuint shapeArray = 0, texturedArray = 0;
+  GLuint skyArray = 0, skyBuffer = 0;
+
+  struct {
+    GLint palette, offset;
+  } meshUniforms = {};
+  std::vector<Mesh> meshes;
+
+  std::vector<GlyphAtlas> atlases;
+
+  bool skyShader;
+  struct {
+    GLint skyColor, groundColor, horizon, sunVisible, sunX, sunCurve,
+        cloudCount, clouds;
+  } skyUniforms = {};
+
+  Readback readbacks[kReadbackSlots];
+  int readbackFirst = 0, readbackCount = 0;
+};
+
+} // namespace
+
+RenderBackend *CreateGL33Renderer(bool skyShader) {
+  if (GLVersion() < 33) {
+    printf("The gl33 backend needs a GL 3.3 context\n");
+    return nullptr;
+  }
+  GL33Renderer *renderer = new GL33Renderer(skyShader);
+  if (!renderer->Init()) {
+    delete renderer;
+    return nullptr;
+  }
+  return renderer;
+}
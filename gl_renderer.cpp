@@ -0,0 +1,919 @@
+#define GL_GLEXT_PROTOTYPES
+#include "render_backend.h"
+
+#include "bitmap_font.h"
+#include "draw_list.h"
+#include "engine.h"
+#include "gl_shaders.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+// Frames in flight between glReadPixels and mapping the result
+const int kReadbackSlots = 3;
+
+struct Readback {
+  GLuint buffer = 0;
+  GLsync fence = nullptr;
+};
+
+const char *const kVersion = "#version 120\n";
+
+const char *kSkyVertexShader = R"(
+varying vec2 position; // window pixels, whatever the viewport
+void main() {
+  position = gl_Vertex.xy;
+  gl_Position = ftransform();
+}
+)";
+
+const char *kSkyFragmentShader = R"(
+varying vec2 position;
+void main() {
+  gl_FragColor = vec4(sky(position), 1.0);
+}
+)";
+
+// Circles, bowls and hearts as quads; the texture coordinate carries the
+// position in shape units and the shape kind
+const char *kShapeVertexShader = R"(
+void main() {
+  gl_TexCoord[0] = gl_MultiTexCoord0;
+  gl_FrontColor = gl_Color;
+  gl_Position = ftransform();
+}
+)";
+
+// Palette meshes: solid triangles and circle quads, the texture coordinate
+// carrying the shape position and kind as above plus the palette index
+const char *kMeshVertexShader = R"(
+uniform vec4 palette[16]; // kMaxPaletteColors
+uniform vec2 offset;
+void main() {
+  gl_TexCoord[0] = vec4(gl_MultiTexCoord0.xyz, 1.0);
+  gl_FrontColor = palette[int(gl_MultiTexCoord0.w)];
+  gl_Position = gl_ModelViewProjectionMatrix *
+                (gl_Vertex + vec4(offset, 0.0, 0.0));
+}
+)";
+
+// Kind 3 is a solid mesh triangle
+const char *kShapeFragmentShader = R"(
+void main() {
+  gl_FragColor =
+      vec4(gl_Color.rgb, gl_Color.a * shapeCoverage(gl_TexCoord[0].xyz));
+}
+)";
+
+// GLSL 1.20 needs GL 2.1. Returns 0, having said why, if it cannot build.
+GLuint BuildLegacyProgram(const char *name, const char *vertexSource,
+                          const char *fragmentSource, const char *library) {
+  if (GLVersion() < 21) {
+    printf("%s shader needs GL 2.1; drawing triangles instead\n", name);
+    return 0;
+  }
+  return BuildProgram(name, kVersion, vertexSource, fragmentSource, library);
+}
+
+struct ShapeVertex {
+  float x, y;
+  float shapeX, shapeY, kind;
+  float r, g, b, a;
+};
+
+const float kSolidKind = 3;
+
+struct MeshVertex {
+  float x, y;
+  float shapeX, shapeY, kind, color;
+};
+
+// Consecutive vertices of one palette color
+struct MeshRun {
+  int color, first, count;
+};
+
+struct Mesh {
+  GLuint buffer;
+  std::vector<MeshRun> runs;
+  DrawBounds bounds; // before the draw's offset
+};
+
+struct TexturedVertex {
+  float x, y, u, v;
+  float r, g, b, a;
+};
+
+// Programs in the order draws sort by within a layer
+enum Program { PROGRAM_FIXED, PROGRAM_SHAPES, PROGRAM_MESH, PROGRAM_SKY };
+enum DrawPrimitive { DRAW_TRIANGLES, DRAW_QUADS, DRAW_BITMAPS };
+
+enum CommandType {
+  COMMAND_VERTICES, // solid triangles and shape quads in vertices
+  COMMAND_TEXTURED, // quads in texturedVertices
+  COMMAND_BITMAP,   // glBitmap text, bitmapTexts[first]
+  COMMAND_MESH,     // meshDraws[first]
+  COMMAND_SKY       // skies[first]
+};
+
+struct Command {
+  CommandType type;
+  int first, count;
+  GLuint texture;
+};
+
+struct BitmapText {
+  const BitmapFont *font;
+  float x, y, r, g, b;
+  int first, length; // in textChars
+};
+
+struct MeshDraw {
+  int mesh;
+  float x, y;
+  float palette[kMaxPaletteColors * 4];
+  int colors;
+};
+
+// A bitmap font's glyphs in one alpha texture, 16 x 16 cells of the widest
+// advance by the font height, for text on a framebuffer that is not at the
+// virtual screen's size
+struct GlyphAtlas {
+  const BitmapFont *font;
+  GLuint texture;
+  int cellWidth;
+};
+
+const DrawBounds kEverywhere = {-1e30f, -1e30f, 1e30f, 1e30f};
+
+template <typename Vertex> DrawBounds BoundsOf(const Vertex *v, int count) {
+  DrawBounds bounds = {v->x, v->y, v->x, v->y};
+  for (int i = 1; i < count; i++) {
+    bounds.left = std::min(bounds.left, v[i].x);
+    bounds.right = std::max(bounds.right, v[i].x);
+    bounds.bottom = std::min(bounds.bottom, v[i].y);
+    bounds.top = std::max(bounds.top, v[i].y);
+  }
+  return bounds;
+}
+
+class GLRenderer : public RenderBackend {
+public:
+  GLRenderer(bool skyShader, bool immediate)
+      : immediate(immediate), skyShader(skyShader) {
+    pixelSizes.push_back({1.0f, 1.0f});
+  }
+
+  const char *Name() const override {
+    return immediate ? "gl-immediate" : "gl";
+  }
+
+  void BeginFrame(float r, float g, float b) override {
+    // The window may be drawn larger or smaller than the virtual screen
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    viewportWidth = std::max(viewport[2], 1);
+    viewportHeight = std::max(viewport[3], 1);
+    pixelSizes.assign(1, {WINDOW_WIDTH / (float)viewportWidth,
+                          WINDOW_HEIGHT / (float)viewportHeight});
+    glClearColor(r, g, b, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+  }
+
+  // GL finishes the frame at glutSwapBuffers or glReadPixels
+  void EndFrame() override {
+    Flush();
+    lastStats = stats;
+    stats = DrawStats();
+  }
+
+  DrawStats LastDrawStats() const override { return lastStats; }
+
+  // Bounds are compared in the units they were recorded in, so the list is
+  // drawn out before every projection change
+  void PushProjection(float left, float right, float bottom,
+                      float top) override {
+    Flush();
+    pixelSizes.push_back(
+        {(right - left) / viewportWidth, (top - bottom) / viewportHeight});
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    gluOrtho2D(left, right, bottom, top);
+    glMatrixMode(GL_MODELVIEW);
+  }
+
+  void PopProjection() override {
+    Flush();
+    if (pixelSizes.size() > 1)
+      pixelSizes.pop_back();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+  }
+
+  // Recorded as triangles, so consecutive solids share one draw call
+  void FillPrimitive(Primitive primitive, const float *xy, int count, float r,
+                     float g, float b, float a) override {
+    int first = (int)vertices.size();
+    auto vertex = [&](int i) {
+      vertices.push_back(
+          {xy[i * 2], xy[i * 2 + 1], 0, 0, kSolidKind, r, g, b, a});
+    };
+    if (primitive == PRIM_TRIANGLES) {
+      for (int i = 0; i + 2 < count; i += 3)
+        for (int k = 0; k < 3; k++)
+          vertex(i + k);
+    } else if (primitive == PRIM_TRIANGLE_FAN) {
+      for (int i = 1; i + 1 < count; i++) {
+        vertex(0);
+        vertex(i);
+        vertex(i + 1);
+      }
+    } else {
+      for (int i = 0; i + 3 < count; i += 4) {
+        const int corners[6] = {0, 1, 2, 0, 2, 3};
+        for (int k : corners)
+          vertex(i + k);
+      }
+    }
+    AddVertices(first, PROGRAM_FIXED);
+  }
+
+  GLuint CreateTexture(const Image &image) override {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.width, image.height, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data());
+    return texture;
+  }
+
+  void DrawTexture(GLuint texture, float x, float y, float w,
+                   float h) override {
+    int first = (int)texturedVertices.size();
+    AddQuad(x, y, w, h, 0, 0, 1, 1, 1, 1, 1);
+    AddTextured(texture, first);
+  }
+
+  // What glutBitmapCharacter does, minus the need for glutInit, so text
+  // also works in an offscreen context. glBitmap draws in framebuffer
+  // pixels, so at any other resolution the glyphs are textured quads sized
+  // in virtual screen pixels instead.
+  void DrawText(const char *text, int length, float x, float y, void *font,
+                float r, float g, float b) override {
+    const BitmapFont &bitmapFont = GetBitmapFont(font);
+    float unitX = pixelSizes.back().first * viewportWidth / WINDOW_WIDTH;
+    float unitY = pixelSizes.back().second * viewportHeight / WINDOW_HEIGHT;
+    float left = x - bitmapFont.xorig * unitX;
+    float bottom = y - bitmapFont.yorig * unitY;
+    float height = bitmapFont.height * unitY;
+
+    if (viewportWidth == WINDOW_WIDTH && viewportHeight == WINDOW_HEIGHT) {
+      int width = 0;
+      for (int i = 0; i < length; i++)
+        width += bitmapFont.Advance((unsigned char)text[i]);
+      bitmapTexts.push_back({&bitmapFont, x, y, r, g, b,
+                             (int)textChars.size(), length});
+      textChars.insert(textChars.end(), text, text + length);
+      Add({COMMAND_BITMAP, (int)bitmapTexts.size() - 1, 1, 0},
+          DrawState(PROGRAM_FIXED, 0, DRAW_BITMAPS),
+          {left, bottom, left + width * unitX, bottom + height});
+      return;
+    }
+
+    const GlyphAtlas &atlas = AtlasFor(bitmapFont);
+    int first = (int)texturedVertices.size();
+    const float cell = 1.0f / 16;
+    for (int i = 0; i < length; i++) {
+      unsigned char c = text[i];
+      int advance = bitmapFont.Advance(c);
+      float width = advance * unitX;
+      AddQuad(left, bottom, width, height, (c % 16) * cell, (c / 16) * cell,
+              advance / (16.0f * atlas.cellWidth), cell, r, g, b);
+      left += width;
+    }
+    AddTextured(atlas.texture, first);
+  }
+
+  // One full-window quad instead of the few hundred triangles of the sun,
+  // clouds and sky rectangles
+  bool DrawSky(const SkyLayer &sky) override {
+    if (!skyShader)
+      return false;
+    if (!skyProgram && !BuildSkyProgram()) {
+      skyShader = false; // fall back to geometry for good
+      return false;
+    }
+    skies.push_back(sky);
+    Add({COMMAND_SKY, (int)skies.size() - 1, 1, 0},
+        DrawState(PROGRAM_SKY, 0, DRAW_QUADS), kEverywhere);
+    return true;
+  }
+
+  // Four corners per shape whatever its size, as two triangles. The quad is
+  // grown by a pixel so the antialiased rim is not clipped.
+  bool FillShape(Shape shape, float x, float y, float size, float r, float g,
+                 float b, float a) override {
+    if (!ShapeProgram())
+      return false;
+    if (size <= 0)
+      return true;
+
+    float left = -1, right = 1, bottom = -1, top = 1;
+    if (shape == SHAPE_BOWL)
+      top = 0;
+    else if (shape == SHAPE_HEART) {
+      left = -16;
+      right = 16;
+      bottom = -12;
+      top = 17;
+    }
+    float growX = pixelSizes.back().first / size;
+    float growY = pixelSizes.back().second / size;
+    left -= growX;
+    right += growX;
+    bottom -= growY;
+    top += growY;
+
+    int first = (int)vertices.size();
+    const float corners[6][2] = {{left, bottom}, {right, bottom},
+                                 {right, top},   {left, bottom},
+                                 {right, top},   {left, top}};
+    for (const float *corner : corners)
+      vertices.push_back({x + corner[0] * size, y + corner[1] * size,
+                          corner[0], corner[1], (float)shape, r, g, b, a});
+    AddVertices(first, PROGRAM_SHAPES);
+    return true;
+  }
+
+  // Circles become quads grown by a window pixel, like FillShape's
+  int CreateMesh(const MeshPart *parts, int count) override {
+    if (!meshProgramTried) {
+      meshProgram = BuildLegacyProgram("Mesh", kMeshVertexShader,
+                                       kShapeFragmentShader, kShapeLibrary);
+      meshProgramTried = true;
+      if (meshProgram) {
+        meshUniforms.palette = glGetUniformLocation(meshProgram, "palette");
+        meshUniforms.offset = glGetUniformLocation(meshProgram, "offset");
+      }
+    }
+    if (!meshProgram)
+      return 0;
+
+    Mesh mesh = {0, {}, kEverywhere};
+    std::vector<MeshVertex> vertices;
+    for (int i = 0; i < count; i++) {
+      const MeshPart &part = parts[i];
+      const float *v = part.xy;
+      float color = (float)part.color;
+      if (mesh.runs.empty() || mesh.runs.back().color != part.color)
+        mesh.runs.push_back({part.color, (int)vertices.size(), 0});
+      mesh.runs.back().count += part.circle ? 6 : 3;
+      if (!part.circle) {
+        for (int k = 0; k < 3; k++)
+          vertices.push_back(
+              {v[k * 2], v[k * 2 + 1], 0, 0, kSolidKind, color});
+        continue;
+      }
+      float edge = 1 + 1 / v[2];
+      const float corners[6][2] = {{-edge, -edge}, {edge, -edge},
+                                   {edge, edge},   {-edge, -edge},
+                                   {edge, edge},   {-edge, edge}};
+      for (const float *corner : corners)
+        vertices.push_back({v[0] + corner[0] * v[2], v[1] + corner[1] * v[2],
+                            corner[0], corner[1], (float)SHAPE_CIRCLE,
+                            color});
+    }
+
+    if (!vertices.empty()) {
+      mesh.bounds = {vertices[0].x, vertices[0].y, vertices[0].x,
+                     vertices[0].y};
+      for (const MeshVertex &vertex : vertices) {
+        mesh.bounds.left = std::min(mesh.bounds.left, vertex.x);
+        mesh.bounds.right = std::max(mesh.bounds.right, vertex.x);
+        mesh.bounds.bottom = std::min(mesh.bounds.bottom, vertex.y);
+        mesh.bounds.top = std::max(mesh.bounds.top, vertex.y);
+      }
+    }
+
+    glGenBuffers(1, &mesh.buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.buffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex),
+                 vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    // A destroyed mesh's slot is given out again
+    for (size_t i = 0; i < meshes.size(); i++)
+      if (!meshes[i].buffer) {
+        meshes[i] = mesh;
+        return (int)i + 1;
+      }
+    meshes.push_back(mesh);
+    return (int)meshes.size();
+  }
+
+  // Draws already queued from the mesh are drawn out first
+  void DestroyMesh(int handle) override {
+    if (handle <= 0 || handle > (int)meshes.size() ||
+        !meshes[handle - 1].buffer)
+      return;
+    Flush();
+    glDeleteBuffers(1, &meshes[handle - 1].buffer);
+    meshes[handle - 1] = {0, {}, kEverywhere};
+  }
+
+  bool DrawMesh(int handle, float x, float y, const float *palette,
+                int colors) override {
+    if (handle <= 0 || handle > (int)meshes.size() ||
+        !meshes[handle - 1].buffer)
+      return false;
+    const Mesh &mesh = meshes[handle - 1];
+    MeshDraw draw = {handle, x, y, {}, std::min(colors, kMaxPaletteColors)};
+    std::copy(palette, palette + draw.colors * 4, draw.palette);
+    meshDraws.push_back(draw);
+    const DrawBounds &b = mesh.bounds;
+    Add({COMMAND_MESH, (int)meshDraws.size() - 1, 1, 0},
+        DrawState(PROGRAM_MESH, mesh.buffer, DRAW_TRIANGLES),
+        {b.left + x, b.bottom + y, b.right + x, b.top + y});
+    return true;
+  }
+
+  void ReadFrame(std::vector<unsigned char> &rgba) override {
+    Flush();
+    rgba.resize(WINDOW_WIDTH * WINDOW_HEIGHT * 4);
+    ReadPixels(rgba.data());
+  }
+
+  // glReadPixels into a pixel buffer object returns immediately; the copy
+  // is mapped a few frames later, once its fence says the GPU is done
+  void QueueReadback() override {
+    Flush();
+    if (!readbackReady)
+      InitReadback();
+    if (!pixelBuffers) { // GL 2.0 and older: read synchronously
+      ReadFrame(syncReadback);
+      readbackCount = 1;
+      return;
+    }
+    if (readbackCount == kReadbackSlots)
+      return; // the caller skipped TakeReadback; drop rather than overwrite
+
+    Readback &slot =
+        readbacks[(readbackFirst + readbackCount) % kReadbackSlots];
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    ReadPixels(nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (fences)
+      slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    readbackCount++;
+  }
+
+  bool TakeReadback(std::vector<unsigned char> &rgba, bool wait) override {
+    if (readbackCount == 0)
+      return false;
+    if (!pixelBuffers) {
+      rgba.swap(syncReadback);
+      readbackCount = 0;
+      return true;
+    }
+
+    Readback &slot = readbacks[readbackFirst];
+    if (!wait && readbackCount < kReadbackSlots) {
+      // Without sync objects the ring depth alone hides the latency
+      if (!slot.fence ||
+          glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+        return false;
+    }
+    if (slot.fence) {
+      glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                       GL_TIMEOUT_IGNORED);
+      glDeleteSync(slot.fence);
+      slot.fence = nullptr;
+    }
+
+    rgba.resize(WINDOW_WIDTH * WINDOW_HEIGHT * 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (const void *pixels = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY)) {
+      memcpy(rgba.data(), pixels, rgba.size());
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readbackFirst = (readbackFirst + 1) % kReadbackSlots;
+    readbackCount--;
+    return true;
+  }
+
+private:
+  bool BuildSkyProgram() {
+    GLuint program =
+        BuildLegacyProgram("Sky", kSkyVertexShader, kSkyFragmentShader,
+                           kSkyLibrary);
+    if (!program)
+      return false;
+
+    skyProgram = program;
+    skyUniforms.skyColor = glGetUniformLocation(program, "skyColor");
+    skyUniforms.groundColor = glGetUniformLocation(program, "groundColor");
+    skyUniforms.horizon = glGetUniformLocation(program, "horizon");
+    skyUniforms.sunVisible = glGetUniformLocation(program, "sunVisible");
+    skyUniforms.sunX = glGetUniformLocation(program, "sunX");
+    skyUniforms.sunCurve = glGetUniformLocation(program, "sunCurve");
+    skyUniforms.cloudCount = glGetUniformLocation(program, "cloudCount");
+    skyUniforms.clouds = glGetUniformLocation(program, "clouds");
+    return true;
+  }
+
+  bool ShapeProgram() {
+    if (!shapeProgramTried) {
+      shapeProgram = BuildLegacyProgram("Shape", kShapeVertexShader,
+                                        kShapeFragmentShader, kShapeLibrary);
+      shapeProgramTried = true;
+      if (shapeProgram) {
+        glUseProgram(shapeProgram);
+        glUniform2fv(glGetUniformLocation(shapeProgram, "heartOutline"),
+                     kHeartOutlinePoints, HeartOutline());
+        glUseProgram(0);
+      }
+    }
+    return shapeProgram != 0;
+  }
+
+  void Add(const Command &command, uint64_t state, const DrawBounds &bounds) {
+    commands.push_back(command);
+    drawList.Add(state, bounds, (int)commands.size() - 1);
+  }
+
+  // The vertices recorded since first, as one command. Solids stay on the
+  // fixed pipeline: the shape program's per-pixel work buys them nothing.
+  void AddVertices(int first, Program program) {
+    int count = (int)vertices.size() - first;
+    if (count == 0)
+      return;
+    Add({COMMAND_VERTICES, first, count, 0},
+        DrawState(program, 0, DRAW_TRIANGLES),
+        BoundsOf(&vertices[first], count));
+  }
+
+  void AddQuad(float x, float y, float w, float h, float u, float v,
+               float du, float dv, float r, float g, float b) {
+    texturedVertices.push_back({x, y, u, v, r, g, b, 1});
+    texturedVertices.push_back({x + w, y, u + du, v, r, g, b, 1});
+    texturedVertices.push_back({x + w, y + h, u + du, v + dv, r, g, b, 1});
+    texturedVertices.push_back({x, y + h, u, v + dv, r, g, b, 1});
+  }
+
+  // The quads recorded since first, as one command
+  void AddTextured(GLuint texture, int first) {
+    int count = (int)texturedVertices.size() - first;
+    if (count == 0)
+      return;
+    Add({COMMAND_TEXTURED, first, count, texture},
+        DrawState(PROGRAM_FIXED, texture, DRAW_QUADS),
+        BoundsOf(&texturedVertices[first], count));
+  }
+
+  // Draws the recorded commands in sorted order. A run of commands with the
+  // same state goes out as one call, and state is only set when it changes.
+  // Immediate renderers draw each command with its own call, as recorded.
+  void Flush() {
+    if (drawList.Empty())
+      return;
+    const std::vector<DrawList::Entry> &order =
+        immediate ? drawList.Recorded() : drawList.Sort();
+    stats.commands += (int)order.size();
+    stats.stateChanges += immediate ? drawList.RecordedChanges()
+                                    : drawList.SortedChanges();
+    stats.unsortedChanges += drawList.RecordedChanges();
+
+    for (size_t begin = 0, end; begin < order.size(); begin = end) {
+      end = begin + 1;
+      while (!immediate && end < order.size() &&
+             order[end].state == order[begin].state)
+        end++;
+      switch (commands[order[begin].payload].type) {
+      case COMMAND_VERTICES:
+        SubmitVertices(order, begin, end);
+        break;
+      case COMMAND_TEXTURED:
+        SubmitTextured(order, begin, end);
+        break;
+      case COMMAND_BITMAP:
+        SubmitBitmaps(order, begin, end);
+        break;
+      case COMMAND_MESH:
+        SubmitMeshes(order, begin, end);
+        break;
+      case COMMAND_SKY:
+        SubmitSkies(order, begin, end);
+        break;
+      }
+    }
+    UseProgram(0);
+    UseTexture(0);
+
+    drawList.Clear();
+    commands.clear();
+    vertices.clear();
+    texturedVertices.clear();
+    bitmapTexts.clear();
+    textChars.clear();
+    meshDraws.clear();
+    skies.clear();
+  }
+
+  void UseProgram(GLuint program) {
+    if (program != currentProgram)
+      glUseProgram(program);
+    currentProgram = program;
+  }
+
+  // 0 turns texturing off
+  void UseTexture(GLuint texture) {
+    if (texture == currentTexture)
+      return;
+    if (!texture || !currentTexture) {
+      if (texture)
+        glEnable(GL_TEXTURE_2D);
+      else
+        glDisable(GL_TEXTURE_2D);
+    }
+    if (texture)
+      glBindTexture(GL_TEXTURE_2D, texture);
+    currentTexture = texture;
+  }
+
+  // The commands' vertex ranges, with neighbouring ones joined
+  void GatherRanges(const std::vector<DrawList::Entry> &order, size_t begin,
+                    size_t end) {
+    rangeFirsts.clear();
+    rangeCounts.clear();
+    for (size_t i = begin; i < end; i++) {
+      const Command &command = commands[order[i].payload];
+      if (!rangeFirsts.empty() &&
+          rangeFirsts.back() + rangeCounts.back() == command.first)
+        rangeCounts.back() += command.count;
+      else {
+        rangeFirsts.push_back(command.first);
+        rangeCounts.push_back(command.count);
+      }
+    }
+  }
+
+  void SubmitVertices(const std::vector<DrawList::Entry> &order,
+                      size_t begin, size_t end) {
+    GatherRanges(order, begin, end);
+    bool shapes = DrawStateProgram(order[begin].state) == PROGRAM_SHAPES;
+    const ShapeVertex *v = vertices.data();
+    UseProgram(shapes ? shapeProgram : 0);
+    UseTexture(0);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(ShapeVertex), &v->x);
+    glColorPointer(4, GL_FLOAT, sizeof(ShapeVertex), &v->r);
+    if (shapes) {
+      glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+      glTexCoordPointer(3, GL_FLOAT, sizeof(ShapeVertex), &v->shapeX);
+    }
+    glMultiDrawArrays(GL_TRIANGLES, rangeFirsts.data(), rangeCounts.data(),
+                      (GLsizei)rangeFirsts.size());
+    if (shapes)
+      glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    stats.drawCalls++;
+  }
+
+  void SubmitTextured(const std::vector<DrawList::Entry> &order,
+                      size_t begin, size_t end) {
+    GatherRanges(order, begin, end);
+    const TexturedVertex *v = texturedVertices.data();
+    UseProgram(0);
+    UseTexture(commands[order[begin].payload].texture);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(TexturedVertex), &v->x);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(TexturedVertex), &v->u);
+    glColorPointer(4, GL_FLOAT, sizeof(TexturedVertex), &v->r);
+    glMultiDrawArrays(GL_QUADS, rangeFirsts.data(), rangeCounts.data(),
+                      (GLsizei)rangeFirsts.size());
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    stats.drawCalls++;
+  }
+
+  void SubmitBitmaps(const std::vector<DrawList::Entry> &order, size_t begin,
+                     size_t end) {
+    UseProgram(0);
+    UseTexture(0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (size_t i = begin; i < end; i++) {
+      const BitmapText &text = bitmapTexts[commands[order[i].payload].first];
+      const BitmapFont &font = *text.font;
+      glColor3f(text.r, text.g, text.b);
+      glRasterPos2f(text.x, text.y);
+      for (int k = 0; k < text.length; k++) {
+        unsigned char c = textChars[text.first + k];
+        int advance = font.Advance(c);
+        glBitmap(advance, font.height, font.xorig, font.yorig, advance, 0,
+                 font.Rows(c));
+      }
+      stats.drawCalls++;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  }
+
+  // Runs in a transparent color are left out, so a season's missing parts
+  // cost no fill. Only the palette and offset change between draws of one
+  // mesh.
+  void SubmitMeshes(const std::vector<DrawList::Entry> &order, size_t begin,
+                    size_t end) {
+    const Mesh &mesh = meshes[meshDraws[commands[order[begin].payload].first]
+                                  .mesh -
+                              1];
+    UseProgram(meshProgram);
+    UseTexture(0);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(MeshVertex),
+                    (const void *)offsetof(MeshVertex, x));
+    glTexCoordPointer(4, GL_FLOAT, sizeof(MeshVertex),
+                      (const void *)offsetof(MeshVertex, shapeX));
+    for (size_t i = begin; i < end; i++) {
+      const MeshDraw &draw = meshDraws[commands[order[i].payload].first];
+      glUniform4fv(meshUniforms.palette, draw.colors, draw.palette);
+      glUniform2f(meshUniforms.offset, draw.x, draw.y);
+      int first = 0, visible = 0;
+      for (const MeshRun &run : mesh.runs) {
+        if (run.color < draw.colors && draw.palette[run.color * 4 + 3] > 0) {
+          if (visible == 0)
+            first = run.first;
+          visible += run.count;
+          continue;
+        }
+        if (visible > 0) {
+          glDrawArrays(GL_TRIANGLES, first, visible);
+          stats.drawCalls++;
+        }
+        visible = 0;
+      }
+      if (visible > 0) {
+        glDrawArrays(GL_TRIANGLES, first, visible);
+        stats.drawCalls++;
+      }
+    }
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+
+  void SubmitSkies(const std::vector<DrawList::Entry> &order, size_t begin,
+                   size_t end) {
+    UseProgram(skyProgram);
+    UseTexture(0);
+    for (size_t i = begin; i < end; i++) {
+      const SkyLayer &sky = skies[commands[order[i].payload].first];
+      glUniform3fv(skyUniforms.skyColor, 1, sky.sky);
+      glUniform3fv(skyUniforms.groundColor, 1, sky.ground);
+      glUniform1f(skyUniforms.horizon, sky.horizon);
+      glUniform1f(skyUniforms.sunVisible, sky.sun ? 1.0f : 0.0f);
+      glUniform1f(skyUniforms.sunX, sky.sunX);
+      glUniform3fv(skyUniforms.sunCurve, 1, sky.sunCurve);
+      float clouds[6];
+      for (int k = 0; k < sky.cloudCount; k++) {
+        clouds[k * 2] = sky.cloudX[k];
+        clouds[k * 2 + 1] = sky.cloudY[k];
+      }
+      glUniform1i(skyUniforms.cloudCount, sky.cloudCount);
+      if (sky.cloudCount > 0)
+        glUniform2fv(skyUniforms.clouds, sky.cloudCount, clouds);
+
+      glBegin(GL_QUADS);
+      glVertex2f(0, 0);
+      glVertex2f(WINDOW_WIDTH, 0);
+      glVertex2f(WINDOW_WIDTH, WINDOW_HEIGHT);
+      glVertex2f(0, WINDOW_HEIGHT);
+      glEnd();
+      stats.drawCalls++;
+    }
+  }
+
+  const GlyphAtlas &AtlasFor(const BitmapFont &font) {
+    for (const GlyphAtlas &atlas : atlases)
+      if (atlas.font == &font)
+        return atlas;
+
+    int cellWidth = 1;
+    for (int c = 0; c < 256; c++)
+      cellWidth = std::max(cellWidth, font.Advance(c));
+    int width = 16 * cellWidth, height = 16 * font.height;
+    std::vector<unsigned char> alpha(width * height, 0);
+    for (int c = 0; c < 256; c++) {
+      int advance = font.Advance(c), stride = (advance + 7) / 8;
+      const unsigned char *rows = font.Rows(c);
+      for (int row = 0; row < font.height; row++)
+        for (int col = 0; col < advance; col++)
+          if (rows[row * stride + col / 8] & (0x80 >> (col % 8)))
+            alpha[((c / 16) * font.height + row) * width +
+                  (c % 16) * cellWidth + col] = 255;
+    }
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0, GL_ALPHA,
+                 GL_UNSIGNED_BYTE, alpha.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    atlases.push_back({&font, texture, cellWidth});
+    return atlases.back();
+  }
+
+  void ReadPixels(void *pixels) {
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+    if (framebuffer == 0) // an offscreen FBO reads its own attachment
+      glReadBuffer(GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels);
+  }
+
+  // Pixel buffer objects are core in GL 2.1, sync objects in 3.2
+  void InitReadback() {
+    int version = GLVersion();
+    pixelBuffers = version >= 21;
+    fences = version >= 32;
+    readbackReady = true;
+    if (!pixelBuffers)
+      return;
+
+    for (Readback &slot : readbacks) {
+      glGenBuffers(1, &slot.buffer);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+      glBufferData(GL_PIXEL_PACK_BUFFER, WINDOW_WIDTH * WINDOW_HEIGHT * 4,
+                   nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+
+  // Units per framebuffer pixel under each pushed projection
+  std::vector<std::pair<float, float>> pixelSizes;
+  int viewportWidth = WINDOW_WIDTH, viewportHeight = WINDOW_HEIGHT;
+
+  // The frame so far, drawn at the next Flush
+  bool immediate;
+  DrawList drawList;
+  std::vector<Command> commands;
+  std::vector<ShapeVertex> vertices;
+  std::vector<TexturedVertex> texturedVertices;
+  std::vector<BitmapText> bitmapTexts;
+  std::vector<char> textChars;
+  std::vector<MeshDraw> meshDraws;
+  std::vector<SkyLayer> skies;
+  std::vector<GLint> rangeFirsts;
+  std::vector<GLsizei> rangeCounts;
+  GLuint currentProgram = 0, currentTexture = 0;
+  DrawStats stats, lastStats;
+
+  bool shapeProgramTried = false;
+  GLuint shapeProgram = 0;
+
+  bool meshProgramTried = false;
+  GLuint meshProgram = 0;
+  struct {
+    GLint palette, offset;
+  } meshUniforms = {};
+  std::vector<Mesh> meshes;
+
+  std::vector<GlyphAtlas> atlases;
+
+  bool skyShader;
+  GLuint skyProgram = 0;
+  struct {
+    GLint skyColor, groundColor, horizon, sunVisible, sunX, sunCurve,
+        cloudCount, clouds;
+  } skyUniforms = {};
+
+  bool readbackReady = false, pixelBuffers = false, fences = false;
+  Readback readbacks[kReadbackSlots];
+  int readbackFirst = 0, readbackCount = 0;
+  std::vector<unsigned char> syncReadback;
+};
+
+} // namespace
+
+RenderBackend *CreateGLRenderer(bool skyShader, bool immediate) {
+  return new GLRenderer(skyShader, immediate);
+}
@@ -0,0 +1,153 @@
+#define GL_GLEXT_PROTOTYPES
+#include "gl_shaders.h"
+
+#include <GL/glext.h>
+
+#include <cstdio>
+
+namespace {
+
+GLuint CompileShader(const char *name, GLenum type, const char *const *sources,
+                     int count) {
+  GLuint shader = glCreateShader(type);
+  glShaderSource(shader, count, sources, nullptr);
+  glCompileShader(shader);
+  GLint ok = 0;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+  if (!ok) {
+    char log[512] = "";
+    glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+    printf("%s shader failed to compile: %s\n", name, log);
+    glDeleteShader(shader);
+    return 0;
+  }
+  return shader;
+}
+
+} // namespace
+
+int GLVersion() {
+  int major = 0, minor = 0;
+  sscanf((const char *)glGetString(GL_VERSION), "%d.%d", &major, &minor);
+  return major * 10 + minor;
+}
+
+GLuint BuildProgram(const char *name, const char *version,
+                    const char *vertexSource, const char *fragmentSource,
+                    const char *library) {
+  const char *vertexSources[] = {version, vertexSource};
+  const char *fragmentSources[] = {version, library, fragmentSource};
+  GLuint vertex = CompileShader(name, GL_VERTEX_SHADER, vertexSources, 2);
+  GLuint fragment =
+      CompileShader(name, GL_FRAGMENT_SHADER, fragmentSources, 3);
+  GLuint program = 0;
+  if (vertex && fragment) {
+    program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glLinkProgram(program);
+    GLint ok = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+      printf("%s shader failed to link\n", name);
+      glDeleteProgram(program);
+      program = 0;
+    }
+  }
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+  return program;
+}
+
+const char *const kShapeLibrary = R"(
+uniform vec2 heartOutline[65]; // kHeartOutlinePoints
+
+float heart(vec2 p) {
+  p.x = abs(p.x);
+  float best = 1e30;
+  bool inside = false;
+  for (int i = 0; i < 65; i++) {
+    vec2 a = heartOutline[i];
+    vec2 e = heartOutline[i == 0 ? 64 : i - 1] - a;
+    vec2 w = p - a;
+    if ((a.y <= p.y) != (a.y + e.y <= p.y) &&
+        p.x < a.x + e.x * (p.y - a.y) / e.y)
+      inside = !inside;
+    if (i > 0) {
+      vec2 b = w - e * clamp(dot(w, e) / dot(e, e), 0.0, 1.0);
+      best = min(best, dot(b, b));
+    }
+  }
+  return inside ? -sqrt(best) : sqrt(best);
+}
+
+float shapeCoverage(vec3 shape) {
+  float pixel = max(length(fwidth(shape.xy)) * 0.70710678, 1e-6);
+  float d;
+  if (shape.z < 0.5)
+    d = length(shape.xy) - 1.0;
+  else if (shape.z < 1.5)
+    d = max(length(shape.xy) - 1.0, shape.y);
+  else if (shape.z < 2.5)
+    d = heart(shape.xy);
+  else
+    d = -1e6;
+  return clamp(0.5 - d / pixel, 0.0, 1.0);
+}
+)";
+
+// Signed distances (negative inside), so every edge gets one pixel of
+// antialiasing
+const char *const kSkyLibrary = R"(
+uniform vec3 skyColor, groundColor;
+uniform float horizon;
+uniform float sunVisible, sunX;
+uniform vec3 sunCurve;
+uniform int cloudCount;
+uniform vec2 clouds[3];
+
+float pixel;
+
+vec3 over(vec3 color, vec3 shape, float distance) {
+  return mix(color, shape, clamp(0.5 - distance / pixel, 0.0, 1.0));
+}
+
+float rays(vec2 p) {
+  // Fold onto the nearest of the 12 rays, then onto its upper half
+  float spacing = 6.2831853 / 12.0;
+  float angle = floor(atan(p.y, p.x) / spacing + 0.5) * spacing;
+  vec2 q = vec2(cos(angle) * p.x + sin(angle) * p.y,
+                abs(cos(angle) * p.y - sin(angle) * p.x));
+  vec2 tip = vec2(60.0, 0.0);
+  vec2 corner = 75.0 * vec2(cos(0.2), sin(0.2));
+  vec2 edge = normalize(corner - tip);
+  return max(dot(q - tip, vec2(-edge.y, edge.x)), q.x - corner.x);
+}
+
+float cloud(vec2 p) {
+  float d = length(p) - 30.0;
+  d = min(d, length(p - vec2(25.0, 10.0)) - 25.0);
+  d = min(d, length(p - vec2(-25.0, 10.0)) - 25.0);
+  return min(d, length(p - vec2(0.0, 15.0)) - 28.0);
+}
+
+vec3 sky(vec2 position) {
+  pixel = max(fwidth(position.x), 1e-4);
+  vec3 color = skyColor;
+  if (sunVisible > 0.5) {
+    float dx = sunX - sunCurve.y;
+    vec2 p = position - vec2(sunX, sunCurve.x * dx * dx + sunCurve.z);
+    if (dot(p, p) < 77.0 * 77.0) { // the rays end at 75
+      color = over(color, vec3(1.0, 0.9, 0.0), length(p) - 50.0);
+      color = over(color, vec3(1.0, 0.8, 0.0), rays(p));
+    }
+  }
+  color = over(color, groundColor, position.y - horizon);
+  for (int i = 0; i < cloudCount; i++) {
+    vec2 p = position - clouds[i];
+    if (abs(p.x) < 52.0 && p.y > -32.0 && p.y < 45.0) // cloud bounds
+      color = over(color, vec3(1.0), cloud(p));
+  }
+  return color;
+}
+)";
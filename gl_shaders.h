@@ -0,0 +1,31 @@
+// Shader building and the GLSL shared by the GL backends. The legacy
+// backend compiles it as GLSL 1.20 against the fixed-function built-ins,
+// the core-profile backend as GLSL 3.30 with its own inputs and outputs;
+// the distance functions in between are the same text for both.
+#ifndef GL_SHADERS_H
+#define GL_SHADERS_H
+
+#include <GL/gl.h>
+
+// The context's GL version as major * 10 + minor, e.g. 33
+int GLVersion();
+
+// Compiles version (a #version line) followed by each stage's source, with
+// library inserted ahead of the fragment source, and links them. Returns 0,
+// having printed why, if either stage fails.
+GLuint BuildProgram(const char *name, const char *version,
+                    const char *vertexSource, const char *fragmentSource,
+                    const char *library = "");
+
+// float shapeCoverage(vec3 shape): the antialiased coverage of a circle
+// (kind 0), bowl (1) or heart (2) at shape.xy in shape units, with shape.z
+// the kind; kind 3 covers everything. Same distances as ShapeDistance in
+// software_renderer.cpp. Needs uniform heartOutline set from HeartOutline().
+extern const char *const kShapeLibrary;
+
+// vec3 sky(vec2 position): the SkyLayer at window pixel position, the
+// same shapes drawSun and drawCloud build from triangles. Its uniforms are
+// named after the SkyLayer fields.
+extern const char *const kSkyLibrary;
+
+#endif
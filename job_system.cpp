@@ -0,0 +1,271 @@
+#include "job_system.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// =============================================================================
+// Chase-Lev deque (Le, Pop, Cohen, Zappa Nardelli: "Correct and Efficient
+// Work-Stealing for Weak Memory Models"). Fixed capacity; when it is full the
+// owner simply runs the job itself.
+// =============================================================================
+
+class WorkDeque {
+public:
+  static const int64_t kCapacity = 4096;
+
+  // Owner only
+  bool Push(Job *job) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= kCapacity)
+      return false;
+    slots[b & (kCapacity - 1)].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Owner only; takes the most recently pushed job
+  Job *Pop() {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) { // empty
+      bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Job *job = slots[b & (kCapacity - 1)].load(std::memory_order_relaxed);
+    if (t == b) {
+      // Last job: race any thief for it
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+        job = nullptr;
+      bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+  }
+
+  // Any thread; takes the oldest job
+  Job *Steal() {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b)
+      return nullptr;
+    Job *job = slots[t & (kCapacity - 1)].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed))
+      return nullptr;
+    return job;
+  }
+
+private:
+  alignas(64) std::atomic<int64_t> top{0};
+  alignas(64) std::atomic<int64_t> bottom{0};
+  std::atomic<Job *> slots[kCapacity];
+};
+
+// A Submit()ed std::function owns its job and frees it after running
+struct FunctionJob {
+  Job job;
+  std::function<void()> function;
+
+  static void Run(void *data, int, int) {
+    FunctionJob *self = static_cast<FunctionJob *>(data);
+    self->function();
+    delete self;
+  }
+};
+
+struct Pool {
+  std::vector<std::unique_ptr<WorkDeque>> deques; // one per worker
+  std::vector<std::thread> threads;
+
+  // Jobs from threads outside the pool, and background jobs
+  std::mutex queueMutex;
+  std::deque<Job *> injected;
+  std::deque<Job *> background;
+
+  // Idle workers sleep here until something is queued
+  std::mutex sleepMutex;
+  std::condition_variable wake;
+  std::atomic<int> queued{0};
+  std::atomic<int> sleeping{0};
+  std::atomic<bool> stopping{false};
+};
+
+// Never freed while running so scenes destroyed at exit can still wait on
+// their counters
+Pool *pool = nullptr;
+thread_local int workerIndex = -1;
+
+void RunJob(Job *job) {
+  JobCounter *counter = job->counter;
+  job->function(job->data, job->begin, job->end); // may free job
+  counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void WakeWorker() {
+  if (pool->sleeping.load() > 0) {
+    std::lock_guard<std::mutex> lock(pool->sleepMutex);
+    pool->wake.notify_one();
+  }
+}
+
+// Queues a job that is already counted; runs it inline if there is no room
+void Enqueue(Job *job) {
+  bool queued;
+  if (workerIndex >= 0) {
+    queued = pool->deques[workerIndex]->Push(job);
+  } else {
+    std::lock_guard<std::mutex> lock(pool->queueMutex);
+    pool->injected.push_back(job);
+    queued = true;
+  }
+  if (!queued) {
+    RunJob(job);
+    return;
+  }
+  pool->queued.fetch_add(1);
+  WakeWorker();
+}
+
+Job *TakeFrom(std::deque<Job *> &queue) {
+  std::lock_guard<std::mutex> lock(pool->queueMutex);
+  if (queue.empty())
+    return nullptr;
+  Job *job = queue.front();
+  queue.pop_front();
+  return job;
+}
+
+// Own deque first, then steal starting at a neighbour so thieves spread out
+Job *FindJob(bool takeBackground) {
+  Job *job = nullptr;
+  int count = (int)pool->deques.size();
+  if (workerIndex >= 0)
+    job = pool->deques[workerIndex]->Pop();
+  for (int i = 1; !job && i <= count; i++)
+    job = pool->deques[(workerIndex + i + count) % count]->Steal();
+  if (!job && (pool->queued.load(std::memory_order_relaxed) > 0))
+    job = TakeFrom(pool->injected);
+  if (!job && takeBackground)
+    job = TakeFrom(pool->background);
+  if (job)
+    pool->queued.fetch_sub(1);
+  return job;
+}
+
+void WorkerLoop(int index) {
+  workerIndex = index;
+  int idleSpins = 0;
+  while (true) {
+    if (Job *job = FindJob(true)) {
+      RunJob(job);
+      idleSpins = 0;
+      continue;
+    }
+    if (++idleSpins < 64) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(pool->sleepMutex);
+    pool->sleeping.fetch_add(1);
+    pool->wake.wait(lock, []() {
+      return pool->queued.load() > 0 || pool->stopping.load();
+    });
+    pool->sleeping.fetch_sub(1);
+    if (pool->stopping.load() && pool->queued.load() == 0)
+      return;
+    idleSpins = 0;
+  }
+}
+
+} // namespace
+
+void StartJobSystem(int threads) {
+  if (pool)
+    return;
+  if (threads <= 0)
+    threads = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+
+  pool = new Pool();
+  for (int i = 0; i <= threads; i++)
+    pool->deques.emplace_back(new WorkDeque());
+  workerIndex = 0;
+  for (int i = 1; i <= threads; i++)
+    pool->threads.emplace_back(WorkerLoop, i);
+}
+
+void StopJobSystem() {
+  if (!pool)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(pool->sleepMutex);
+    pool->stopping.store(true);
+    pool->wake.notify_all();
+  }
+  for (std::thread &thread : pool->threads)
+    thread.join();
+  delete pool;
+  pool = nullptr;
+  workerIndex = -1;
+}
+
+int JobWorkerCount() { return pool ? (int)pool->deques.size() : 1; }
+
+void SubmitJobs(Job *jobs, int count, JobCounter &counter) {
+  counter.pending.fetch_add(count, std::memory_order_relaxed);
+  for (int i = 0; i < count; i++) {
+    jobs[i].counter = &counter;
+    if (pool)
+      Enqueue(&jobs[i]);
+    else
+      RunJob(&jobs[i]);
+  }
+}
+
+void Submit(JobCounter &counter, std::function<void()> function) {
+  FunctionJob *job = new FunctionJob();
+  job->job = {FunctionJob::Run, job, 0, 0, nullptr};
+  job->function = std::move(function);
+  SubmitJobs(&job->job, 1, counter);
+}
+
+void SubmitBackground(JobCounter &counter, std::function<void()> function) {
+  FunctionJob *job = new FunctionJob();
+  job->job = {FunctionJob::Run, job, 0, 0, &counter};
+  job->function = std::move(function);
+  counter.pending.fetch_add(1, std::memory_order_relaxed);
+  if (!pool) {
+    RunJob(&job->job);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(pool->queueMutex);
+    pool->background.push_back(&job->job);
+  }
+  pool->queued.fetch_add(1);
+  WakeWorker();
+}
+
+void Wait(JobCounter &counter) {
+  while (!counter.Done()) {
+    // Never a background job: the wait would stall behind it
+    Job *job = pool ? FindJob(false) : nullptr;
+    if (job)
+      RunJob(job);
+    else
+      std::this_thread::yield();
+  }
+}
@@ -0,0 +1,73 @@
+// Work-stealing job system. Every worker owns a Chase-Lev deque: it pushes
+// and pops its own jobs at the bottom while idle workers steal from the top.
+// The thread that starts the system is worker 0 and helps run jobs while it
+// waits on a counter, so splitting per-frame work never idles the main
+// thread. Long-running work (scene preloads) goes to a separate background
+// queue that only the pool threads take, so a frame never waits on it.
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+// Counts jobs that have not finished yet; Wait() returns once it reaches 0
+struct JobCounter {
+  std::atomic<int> pending{0};
+  bool Done() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+struct Job {
+  void (*function)(void *data, int begin, int end);
+  void *data;
+  int begin, end;
+  JobCounter *counter;
+};
+
+// Starts the pool with the calling thread as worker 0. threads is the number
+// of extra worker threads; 0 picks one per remaining hardware core.
+void StartJobSystem(int threads = 0);
+// Finishes queued jobs and joins the workers
+void StopJobSystem();
+// Worker threads plus the main thread, or 1 when the pool is not running
+int JobWorkerCount();
+
+// Queues jobs and adds them to counter. Without a running pool they run
+// immediately on the caller.
+void SubmitJobs(Job *jobs, int count, JobCounter &counter);
+void Submit(JobCounter &counter, std::function<void()> function);
+// Same as Submit, but only pool threads take it and never a thread in Wait()
+void SubmitBackground(JobCounter &counter, std::function<void()> function);
+
+// Runs queued jobs until the counter reaches zero
+void Wait(JobCounter &counter);
+
+// Splits [0, count) into chunks of at least grain items and runs
+// body(begin, end) on each in parallel, returning when all are done
+const int kMaxParallelChunks = 64;
+
+template <typename F> void ParallelFor(int count, int grain, const F &body) {
+  if (count <= 0)
+    return;
+  int chunks = std::min((count + grain - 1) / grain, kMaxParallelChunks);
+  chunks = std::min(chunks, JobWorkerCount() * 4);
+  if (chunks <= 1 || JobWorkerCount() == 1) {
+    body(0, count);
+    return;
+  }
+
+  Job jobs[kMaxParallelChunks];
+  for (int i = 0; i < chunks; i++) {
+    jobs[i].function = [](void *data, int begin, int end) {
+      (*static_cast<const F *>(data))(begin, end);
+    };
+    jobs[i].data = (void *)&body;
+    jobs[i].begin = (int)((long long)count * i / chunks);
+    jobs[i].end = (int)((long long)count * (i + 1) / chunks);
+  }
+  JobCounter counter;
+  SubmitJobs(jobs, chunks, counter);
+  Wait(counter);
+}
+
+#endif
@@ -0,0 +1,548 @@
+// Battle Through the Seasons: menu, cutscenes and the catcher game in one
+// window, driven by a single scene manager.
+//
+// QA options:
+//   --scene NAME        start at a scene (menu, woods, house, porridge,
+//                       bears, demand, narrative, game)
+//   --seek T|MARKER     jump the start scene to T seconds or a named marker
+//   --speed N           run N simulation ticks per displayed frame
+//   --seed N            fixed random seed for reproducible runs
+//   --headless          render only the frames listed in --frames to PPM
+//                       files in --out (default ".") and exit
+//   --frames A,B,...    times or markers to render in headless mode
+//   --run-frames N      play N frames as fast as possible without a window,
+//                       then print per-scene render times and exit
+//   --backend gl|gl33|software
+//                       gl33 draws through a GL 3.3 core profile context;
+//                       software rasterizes on the CPU
+//   --sky-shader        GL draws the sky, sun and clouds with one fragment
+//                       program instead of triangles
+//   --capture PATH      record every displayed frame, as PATH/frame_NNNNN.png
+//                       or, if PATH ends in .y4m, as raw video
+//   --trace PATH        record every draw call to PATH, gzip-compressed, for
+//                       replaying through any backend (tools/trace_replay)
+//   --vsync             let the buffer swap pace frames to the display
+//   --frame-stats       print frame interval statistics every 5 seconds
+//   --on-demand         draw only when the picture changes, and sleep while
+//                       a still scene waits for input
+//   --dynamic-resolution
+//                       GL renders below window resolution when frames run
+//                       over budget, and scales the result up
+//   --bot               the game plays itself with the catcher bot
+//
+// --headless and --run-frames never open a window: GL renders into an
+// offscreen EGL context instead, so neither needs an X server.
+#include "assets.h"
+#include "capture.h"
+#include "engine.h"
+#include "frame_arena.h"
+#include "frame_pacer.h"
+#include "job_system.h"
+#include "offscreen_gl.h"
+#include "random.h"
+#include "render_backend.h"
+#include "scene.h"
+#include "scene_manager.h"
+#include "trace.h"
+#include "virtual_screen.h"
+
+#include <GL/freeglut_ext.h>
+#include <GL/glx.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Options {
+  const char *scene = nullptr;
+  const char *seek = nullptr;
+  int speed = 1;
+  int seed = -1;
+  bool headless = false;
+  bool software = false;
+  bool coreProfile = false;
+  bool skyShader = false;
+  bool vsync = false;
+  bool frameStats = false;
+  bool onDemand = false;
+  bool dynamicResolution = false;
+  bool bot = false;
+  int runFrames = 0;
+  std::vector<std::string> frames;
+  std::string outDir = ".";
+  const char *capture = nullptr;
+  const char *trace = nullptr;
+};
+
+Options options;
+SceneManager scenes;
+FramePacer pacer(kTickSeconds);
+std::vector<unsigned char> frame;
+
+// Dynamic resolution keeps a fifth of each tick free for the simulation
+VirtualScreen screen;
+ScaledTarget target;
+ResolutionController resolution(kTickSeconds * 1000 * 0.8f);
+
+void renderFrame() {
+  BeginFrameArena();
+  Renderer()->BeginFrame(0.46f, 0.92f, 0.96f);
+  scenes.Render();
+  Renderer()->EndFrame();
+}
+
+// Clears the bars around the virtual screen and confines drawing to it
+void beginLetterbox(const ScreenRect &view) {
+  glViewport(0, 0, screen.WindowWidth(), screen.WindowHeight());
+  glClearColor(0, 0, 0, 1);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glViewport(view.x, view.y, view.width, view.height);
+  glScissor(view.x, view.y, view.width, view.height);
+  glEnable(GL_SCISSOR_TEST);
+}
+
+void display() {
+  auto start = std::chrono::steady_clock::now();
+  const ScreenRect &view = screen.View();
+
+  // GL draws into the scaled target when resolution is dynamic, and at
+  // exactly the virtual size while recording so captures keep their size
+  int width = (int)(view.width * resolution.Scale() + 0.5f);
+  int height = (int)(view.height * resolution.Scale() + 0.5f);
+  if (options.capture) {
+    width = WINDOW_WIDTH;
+    height = WINDOW_HEIGHT;
+  }
+  bool scaled = !options.software &&
+                (options.dynamicResolution || options.capture) &&
+                target.Begin(width, height);
+  if (!scaled) {
+    width = view.width;
+    height = view.height;
+    beginLetterbox(view);
+  }
+  // The software framebuffer stays at virtual size however large the window
+  if (!options.software)
+    setDisplayScale(width / (float)WINDOW_WIDTH);
+
+  renderFrame();
+  CaptureFrame();
+  if (scaled)
+    target.Present(view, screen.WindowWidth(), screen.WindowHeight());
+  if (options.software) {
+    // Present the CPU framebuffer through the window
+    Renderer()->ReadFrame(frame);
+    glRasterPos2i(0, 0);
+    glPixelZoom(view.width / (float)WINDOW_WIDTH,
+                view.height / (float)WINDOW_HEIGHT);
+    glDrawPixels(WINDOW_WIDTH, WINDOW_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE,
+                 frame.data());
+  }
+  glDisable(GL_SCISSOR_TEST);
+  glutSwapBuffers();
+
+  if (options.dynamicResolution && scaled) {
+    // GPU times where timer queries exist, else the whole frame on the CPU
+    double ms = 0;
+    bool timed = false;
+    while (target.TakeFrameTime(ms)) {
+      resolution.Update(ms);
+      timed = true;
+    }
+    if (!timed && !target.Timed())
+      resolution.Update(std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start)
+                            .count());
+  }
+}
+
+void wake();
+
+// Letterboxes the virtual screen into the new window size
+void reshape(int width, int height) {
+  screen.Resize(width, height);
+  Invalidate();
+  wake();
+}
+
+void printFrameStats() {
+  const FrameStats &stats = pacer.Stats();
+  printf("frames %d: avg %.2f ms, jitter %.3f ms, min %.2f, max %.2f, "
+         "late %d\n",
+         stats.frames, stats.Mean(), stats.Jitter(), stats.shortest,
+         stats.longest, stats.late);
+  long heap = TakeHeapAllocations();
+  if (heap >= 0)
+    printf("heap allocations since last stats: %ld\n", heap);
+  pacer.ResetStats();
+}
+
+// Ticks a still scene keeps running after an event, so whatever the event
+// set off is drawn before the loop goes to sleep
+const int kWakeTicks = 15;
+int wakeTicks = kWakeTicks;
+
+// The one loop: wait for the frame's deadline, run the ticks it owes, draw
+// if anything changed. Frames that will not be drawn need no precise start.
+void idle() {
+  bool animating = scenes.CurrentActivity() == Scene::ANIMATING;
+  int ticks = pacer.Wait(!options.onDemand || animating);
+  for (int i = 0; i < ticks * options.speed; i++)
+    scenes.Update(kTickSeconds);
+  if (scenes.TakeRedraw())
+    glutPostRedisplay();
+
+  if (options.frameStats && pacer.Stats().total >= 5000)
+    printFrameStats();
+
+  // Nothing left to do until an event; GLUT blocks in the meantime
+  if (options.onDemand && scenes.CurrentActivity() == Scene::STILL &&
+      --wakeTicks <= 0) {
+    glutIdleFunc(nullptr);
+    pacer.Resume();
+  }
+}
+
+// Restarts the loop after it went to sleep
+void wake() {
+  wakeTicks = kWakeTicks;
+  glutIdleFunc(idle);
+}
+
+// Swap interval 1 through whichever GLX extension the driver has
+bool enableVsync() {
+  typedef int (*SwapInterval)(unsigned int);
+  const char *names[] = {"glXSwapIntervalMESA", "glXSwapIntervalSGI"};
+  for (const char *name : names) {
+    auto swapInterval =
+        (SwapInterval)glXGetProcAddressARB((const GLubyte *)name);
+    if (swapInterval && swapInterval(1) == 0)
+      return true;
+  }
+  return false;
+}
+
+void keyboard(unsigned char key, int x, int y) {
+  screen.ToVirtual(x, y);
+  scenes.HandleKeyPress(key, x, y);
+  wake();
+}
+
+void keyboardUp(unsigned char key, int x, int y) {
+  screen.ToVirtual(x, y);
+  scenes.HandleKeyRelease(key, x, y);
+  wake();
+}
+
+void special(int key, int x, int y) {
+  screen.ToVirtual(x, y);
+  scenes.HandleSpecialKeyPress(key, x, y);
+  wake();
+}
+
+void specialUp(int key, int x, int y) {
+  screen.ToVirtual(x, y);
+  scenes.HandleSpecialKeyRelease(key, x, y);
+  wake();
+}
+
+void mouse(int button, int state, int x, int y) {
+  screen.ToVirtual(x, y);
+  scenes.HandleMouse(button, state, x, y);
+  wake();
+}
+
+void initGL() {
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  gluOrtho2D(0, WINDOW_WIDTH, 0, WINDOW_HEIGHT);
+  glMatrixMode(GL_MODELVIEW);
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void parseOptions(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (strcmp(arg, "--assets") == 0 && hasValue)
+      SetAssetDirectory(argv[++i]);
+    else if (strcmp(arg, "--scene") == 0 && hasValue)
+      options.scene = argv[++i];
+    else if (strcmp(arg, "--seek") == 0 && hasValue)
+      options.seek = argv[++i];
+    else if (strcmp(arg, "--speed") == 0 && hasValue)
+      options.speed = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+    else if (strcmp(arg, "--seed") == 0 && hasValue)
+      options.seed = atoi(argv[++i]);
+    else if (strcmp(arg, "--run-frames") == 0 && hasValue)
+      options.runFrames = atoi(argv[++i]);
+    else if (strcmp(arg, "--out") == 0 && hasValue)
+      options.outDir = argv[++i];
+    else if (strcmp(arg, "--capture") == 0 && hasValue)
+      options.capture = argv[++i];
+    else if (strcmp(arg, "--trace") == 0 && hasValue)
+      options.trace = argv[++i];
+    else if (strcmp(arg, "--backend") == 0 && hasValue) {
+      const char *backend = argv[++i];
+      if (strcmp(backend, "software") == 0)
+        options.software = true;
+      else if (strcmp(backend, "gl33") == 0)
+        options.coreProfile = true;
+      else if (strcmp(backend, "gl") != 0) {
+        printf("Unknown backend: %s\n", backend);
+        exit(1);
+      }
+    } else if (strcmp(arg, "--sky-shader") == 0)
+      options.skyShader = true;
+    else if (strcmp(arg, "--vsync") == 0)
+      options.vsync = true;
+    else if (strcmp(arg, "--frame-stats") == 0)
+      options.frameStats = true;
+    else if (strcmp(arg, "--on-demand") == 0)
+      options.onDemand = true;
+    else if (strcmp(arg, "--dynamic-resolution") == 0)
+      options.dynamicResolution = true;
+    else if (strcmp(arg, "--bot") == 0)
+      options.bot = true;
+    else if (strcmp(arg, "--headless") == 0)
+      options.headless = true;
+    else if (strcmp(arg, "--frames") == 0 && hasValue) {
+      std::string list = argv[++i];
+      size_t start = 0;
+      while (start <= list.size()) {
+        size_t comma = list.find(',', start);
+        if (comma == std::string::npos)
+          comma = list.size();
+        if (comma > start)
+          options.frames.push_back(list.substr(start, comma - start));
+        start = comma + 1;
+      }
+    } else {
+      printf("Unknown option: %s\n", arg);
+      exit(1);
+    }
+  }
+}
+
+// Headless and timed runs render offscreen and never touch GLUT
+bool needsWindow(int argc, char **argv) {
+  for (int i = 1; i < argc; i++)
+    if (strcmp(argv[i], "--headless") == 0 ||
+        strcmp(argv[i], "--run-frames") == 0)
+      return false;
+  return true;
+}
+
+// Seeks to each requested frame and writes it out, without running the loop
+int renderHeadless() {
+  for (const std::string &spec : options.frames) {
+    if (!scenes.Seek(spec.c_str())) {
+      printf("Cannot seek %s to %s\n", scenes.Current()->Name(), spec.c_str());
+      return 1;
+    }
+    renderFrame();
+    Renderer()->ReadFrame(frame);
+
+    std::string path = options.outDir + "/frame_" + scenes.Current()->Name() +
+                       "_" + spec + ".ppm";
+    if (!WritePPM(path.c_str(), WINDOW_WIDTH, WINDOW_HEIGHT, frame.data()))
+      return 1;
+    printf("Wrote %s\n", path.c_str());
+  }
+  return 0;
+}
+
+// Plays the story from the start scene as a render workload, timing each
+// frame (GL included, by waiting for it to finish) and grouping by scene
+int runFrames() {
+  struct SceneTimes {
+    const char *name;
+    int frames;
+    double total, worst;
+    DrawStats draws; // summed over the frames
+    long heap;       // operator new calls, in FRAME_ARENA_DEBUG builds
+  };
+  std::vector<SceneTimes> times;
+
+  auto runStart = std::chrono::steady_clock::now();
+  bool countHeap = TakeHeapAllocations() >= 0;
+  for (int i = 0; i < options.runFrames; i++) {
+    for (int tick = 0; tick < options.speed; tick++)
+      scenes.Update(kTickSeconds);
+
+    auto start = std::chrono::steady_clock::now();
+    renderFrame();
+    if (!options.software)
+      glFinish();
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+
+    const char *name = scenes.Current()->Name();
+    if (times.empty() || times.back().name != name)
+      times.push_back({name, 0, 0, 0, DrawStats(), 0});
+    SceneTimes &scene = times.back();
+    scene.frames++;
+    scene.total += ms;
+    scene.worst = std::max(scene.worst, ms);
+    DrawStats draws = Renderer()->LastDrawStats();
+    scene.draws.commands += draws.commands;
+    scene.draws.drawCalls += draws.drawCalls;
+    scene.draws.stateChanges += draws.stateChanges;
+    scene.draws.unsortedChanges += draws.unsortedChanges;
+    CaptureFrame(); // outside the timing; the recorder reports its own
+    scene.heap += TakeHeapAllocations();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - runStart)
+                       .count();
+
+  // Draw counts are per frame; "states" are the switches between sorted
+  // draws, "unsorted" what recording order would have needed
+  bool counted = false;
+  for (const SceneTimes &scene : times)
+    counted |= scene.draws.commands > 0;
+  printf("%-10s %8s %10s %10s", "scene", "frames", "avg ms", "worst ms");
+  if (counted)
+    printf(" %9s %7s %7s %9s", "commands", "draws", "states", "unsorted");
+  if (countHeap)
+    printf(" %7s", "heap");
+  printf("\n");
+  for (const SceneTimes &scene : times) {
+    printf("%-10s %8d %10.3f %10.3f", scene.name, scene.frames,
+           scene.total / scene.frames, scene.worst);
+    if (counted) {
+      double frames = scene.frames;
+      printf(" %9.1f %7.1f %7.1f %9.1f", scene.draws.commands / frames,
+             scene.draws.drawCalls / frames,
+             scene.draws.stateChanges / frames,
+             scene.draws.unsortedChanges / frames);
+    }
+    if (countHeap)
+      printf(" %7.2f", scene.heap / (double)scene.frames);
+    printf("\n");
+  }
+  printf("%d frames in %.2f s (%.1f fps) on the %s backend\n",
+         options.runFrames, seconds, options.runFrames / seconds,
+         Renderer()->Name());
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  // glutInit strips its own options from argv before ours are parsed
+  bool window = needsWindow(argc, argv);
+  if (window)
+    glutInit(&argc, argv);
+  parseOptions(argc, argv);
+
+  if (window) {
+    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB);
+    glutInitWindowSize(WINDOW_WIDTH, WINDOW_HEIGHT);
+    glutInitWindowPosition(100, 100);
+    if (options.coreProfile) {
+      glutInitContextVersion(3, 3);
+      glutInitContextProfile(GLUT_CORE_PROFILE);
+    }
+    glutCreateWindow("Battle Through the Seasons");
+  } else if (!options.software) {
+    // Drivers without core profiles still run the legacy path
+    if (options.coreProfile &&
+        !CreateOffscreenContext(WINDOW_WIDTH, WINDOW_HEIGHT, true)) {
+      printf("No GL 3.3 core context; using the gl backend\n");
+      DestroyOffscreenContext();
+      options.coreProfile = false;
+    }
+    if (!options.coreProfile &&
+        !CreateOffscreenContext(WINDOW_WIDTH, WINDOW_HEIGHT))
+      return 1;
+  }
+
+  // Any legacy context, including the window software frames are shown in
+  if ((window || !options.software) && !options.coreProfile)
+    initGL();
+  if (options.software)
+    SetRenderer(CreateSoftwareRenderer(WINDOW_WIDTH, WINDOW_HEIGHT));
+  else if (options.coreProfile) {
+    RenderBackend *renderer = CreateGL33Renderer(options.skyShader);
+    if (!renderer)
+      return 1;
+    SetRenderer(renderer);
+  } else
+    SetRenderer(CreateGLRenderer(options.skyShader));
+  StartJobSystem();
+
+  // Before the scenes load their textures, so the trace holds them
+  if (options.trace) {
+    if (!StartTrace(options.trace))
+      return 1;
+    atexit(StopTrace);
+  }
+
+  // Scenes draw their first numbers when constructed
+  if (options.seed >= 0)
+    SetRandomSeed(options.seed);
+  SetRenderOnDemand(options.onDemand);
+  SetRealTimeSimulation(window);
+  SetSimulationSpeed(options.speed);
+
+  scenes.Add(CreateMenuScene());
+  scenes.Add(CreateWoodsScene());
+  scenes.Add(CreateHouseScene());
+  scenes.Add(CreatePorridgeScene());
+  scenes.Add(CreateBearsWakeScene());
+  scenes.Add(CreateBearsDemandScene());
+  scenes.Add(CreateNarrativeScene());
+  scenes.Add(CreateGameScene(options.bot));
+
+  int start = 0;
+  if (options.scene) {
+    start = scenes.Find(options.scene);
+    if (start < 0) {
+      printf("Unknown scene: %s\n", options.scene);
+      return 1;
+    }
+  }
+  scenes.Start(start);
+
+  if (options.headless)
+    return renderHeadless();
+
+  if (options.seek && !scenes.Seek(options.seek)) {
+    printf("Cannot seek %s to %s\n", scenes.Current()->Name(), options.seek);
+    return 1;
+  }
+
+  // Exit paths run through exit(), so the recording is finished from there
+  if (options.capture) {
+    if (!StartCapture(options.capture, WINDOW_WIDTH, WINDOW_HEIGHT))
+      return 1;
+    atexit(StopCapture);
+  }
+
+  if (options.runFrames > 0)
+    return runFrames();
+
+  glutDisplayFunc(display);
+  glutReshapeFunc(reshape);
+  glutKeyboardFunc(keyboard);
+  glutKeyboardUpFunc(keyboardUp);
+  glutSpecialFunc(special);
+  glutSpecialUpFunc(specialUp);
+  glutMouseFunc(mouse);
+  glutIdleFunc(idle);
+
+  if (options.vsync) {
+    if (enableVsync())
+      pacer.SetVsync(true);
+    else
+      printf("No swap interval control; pacing by the clock instead\n");
+  }
+
+  glutMainLoop();
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include "observation_grid.h"
+
+#include "batch_env.h"
+#include "engine.h"
+#include "game_rules.h"
+#include "job_system.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+const int kDrawGrain = 256;
+
+// A box spans at most this many cells across, at the sizes a grid is meant
+// for; wider boxes (a grid near window resolution) are drawn in pieces
+const int kMaxSpan = 32;
+
+// How much of cell [cell, cell + 1) the span [a, b) covers
+float Overlap(int cell, float a, float b) {
+  return std::max(0.0f, std::min(b, cell + 1.0f) - std::max(a, (float)cell));
+}
+
+} // namespace
+
+ObservationGrid::ObservationGrid(int width, int height)
+    : width(width), height(height), scaleX((float)width / WINDOW_WIDTH),
+      scaleY((float)height / WINDOW_HEIGHT) {}
+
+void ObservationGrid::FillBox(uint8_t *plane, float x0, float y0, float x1,
+                              float y1) const {
+  x0 = std::max(x0, 0.0f);
+  y0 = std::max(y0, 0.0f);
+  x1 = std::min(x1, (float)width);
+  y1 = std::min(y1, (float)height);
+  if (x0 >= x1 || y0 >= y1)
+    return;
+  int col0 = (int)x0, col1 = std::min((int)std::ceil(x1), width);
+  int row0 = (int)y0, row1 = std::min((int)std::ceil(y1), height);
+
+  // Coverage is separable for an axis-aligned box, so each cell is the
+  // product of its column's and its row's share. Rows the box covers fully
+  // add the same bytes, made once.
+  float columns[kMaxSpan];
+  uint8_t full[kMaxSpan];
+  for (int start = col0; start < col1; start += kMaxSpan) {
+    int end = std::min(start + kMaxSpan, col1), span = end - start;
+    for (int col = start; col < end; col++) {
+      columns[col - start] = Overlap(col, x0, x1) * 255.0f;
+      full[col - start] = (uint8_t)(columns[col - start] + 0.5f);
+    }
+    for (int row = row0; row < row1; row++) {
+      float share = Overlap(row, y0, y1);
+      uint8_t *cell = plane + (size_t)row * width + start;
+      if (share == 1.0f) {
+        for (int col = 0; col < span; col++)
+          cell[col] = (uint8_t)std::min(255, cell[col] + full[col]);
+        continue;
+      }
+      for (int col = 0; col < span; col++) {
+        int value = (int)(columns[col] * share + 0.5f);
+        cell[col] = (uint8_t)std::min(255, cell[col] + value);
+      }
+    }
+  }
+}
+
+void ObservationGrid::Draw(const BatchEnv &env, int game,
+                           uint8_t *out) const {
+  size_t plane = (size_t)width * height;
+  memset(out, 0, Size());
+
+  // Window y runs up from the bottom, rows run down from the top
+  float basketX = env.BasketX(game) * scaleX;
+  FillBox(out + GRID_BASKET * plane, basketX,
+          (WINDOW_HEIGHT - BASKET_Y - BASKET_HEIGHT) * scaleY,
+          basketX + BASKET_WIDTH * scaleX, (WINDOW_HEIGHT - BASKET_Y) * scaleY);
+
+  for (int s = 0; s < BatchEnv::kItemSlots; s++) {
+    float kind = env.ItemKind(game, s);
+    if (kind == 0)
+      continue;
+    float x = env.ItemX(game, s) * scaleX;
+    float top = (WINDOW_HEIGHT - env.ItemY(game, s) - ITEM_SIZE) * scaleY;
+    uint8_t *channel =
+        out + (kind > 0 ? GRID_GOOD_ITEMS : GRID_BAD_ITEMS) * plane;
+    FillBox(channel, x, top, x + ITEM_SIZE * scaleX, top + ITEM_SIZE * scaleY);
+  }
+
+  uint8_t *hud = out + GRID_HUD * plane;
+  float bars[] = {(float)env.Score(game) / LEVEL_UP_SCORE,
+                  (float)env.Lives(game) / STARTING_LIVES,
+                  (float)std::min(env.Level(game), kLevelBar) / kLevelBar};
+  for (int i = 0; i < 3; i++) {
+    float length = std::min(bars[i], 1.0f) * width;
+    int cells = (int)length;
+    uint8_t *row = hud + (size_t)i * width;
+    memset(row, 255, cells);
+    if (cells < width)
+      row[cells] = (uint8_t)((length - cells) * 255.0f + 0.5f);
+  }
+}
+
+void ObservationGrid::DrawAll(const BatchEnv &env, uint8_t *out) const {
+  ParallelFor(env.Count(), kDrawGrain, [&](int begin, int end) {
+    for (int i = begin; i < end; i++)
+      Draw(env, i, out + i * Size());
+  });
+}
@@ -0,0 +1,48 @@
+// Small multi-channel images of Season Catcher games for agents that learn
+// from pixels rather than from item lists. Each game is drawn straight from
+// BatchEnv's state into a caller's buffer, one byte per cell and channel,
+// with the boxes' edges antialiased by how much of each cell they cover.
+#ifndef OBSERVATION_GRID_H
+#define OBSERVATION_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+
+class BatchEnv;
+
+class ObservationGrid {
+public:
+  // Channel planes, each height rows of width cells, top row first
+  enum Channel {
+    GRID_BASKET,
+    GRID_GOOD_ITEMS,
+    GRID_BAD_ITEMS,
+    // Bars along the top rows, full width at the maximum: the score towards
+    // the next level, then the lives left, then the level up to kLevelBar
+    GRID_HUD,
+    GRID_CHANNELS
+  };
+  static const int kLevelBar = 10;
+
+  // The whole 900x600 window scaled into width x height cells
+  explicit ObservationGrid(int width = 84, int height = 56);
+
+  int Width() const { return width; }
+  int Height() const { return height; }
+  // Bytes per game
+  size_t Size() const { return (size_t)width * height * GRID_CHANNELS; }
+
+  // Draws game into out, Size() bytes
+  void Draw(const BatchEnv &env, int game, uint8_t *out) const;
+  // Draws every game, game i at out + i * Size(), split across the job system
+  void DrawAll(const BatchEnv &env, uint8_t *out) const;
+
+private:
+  // Adds the box [x0, x1) x [y0, y1), in cells, to plane
+  void FillBox(uint8_t *plane, float x0, float y0, float x1, float y1) const;
+
+  int width, height;
+  float scaleX, scaleY; // cells per pixel
+};
+
+#endif
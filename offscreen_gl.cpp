@@ -0,0 +1,135 @@
+#include "offscreen_gl.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#include <cstdio>
+
+namespace {
+
+EGLDisplay display = EGL_NO_DISPLAY;
+EGLContext context = EGL_NO_CONTEXT;
+EGLSurface surface = EGL_NO_SURFACE;
+GLuint framebuffer = 0, colorBuffer = 0;
+
+EGLDisplay OpenDisplay() {
+  // Prefer Mesa's surfaceless platform; the default display may want X
+  auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress(
+      "eglGetPlatformDisplayEXT");
+  if (getPlatformDisplay) {
+    EGLDisplay surfaceless = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                                EGL_DEFAULT_DISPLAY, nullptr);
+    if (surfaceless != EGL_NO_DISPLAY && eglInitialize(surfaceless, 0, 0))
+      return surfaceless;
+  }
+  EGLDisplay fallback = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  if (fallback != EGL_NO_DISPLAY && eglInitialize(fallback, 0, 0))
+    return fallback;
+  return EGL_NO_DISPLAY;
+}
+
+// Surfaceless contexts have no default framebuffer, so render into an FBO
+bool CreateFramebuffer(int width, int height) {
+  auto genFramebuffers =
+      (PFNGLGENFRAMEBUFFERSPROC)eglGetProcAddress("glGenFramebuffers");
+  auto bindFramebuffer =
+      (PFNGLBINDFRAMEBUFFERPROC)eglGetProcAddress("glBindFramebuffer");
+  auto genRenderbuffers =
+      (PFNGLGENRENDERBUFFERSPROC)eglGetProcAddress("glGenRenderbuffers");
+  auto bindRenderbuffer =
+      (PFNGLBINDRENDERBUFFERPROC)eglGetProcAddress("glBindRenderbuffer");
+  auto renderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)eglGetProcAddress(
+      "glRenderbufferStorage");
+  auto framebufferRenderbuffer =
+      (PFNGLFRAMEBUFFERRENDERBUFFERPROC)eglGetProcAddress(
+          "glFramebufferRenderbuffer");
+  if (!genFramebuffers || !bindFramebuffer || !genRenderbuffers ||
+      !bindRenderbuffer || !renderbufferStorage || !framebufferRenderbuffer)
+    return false;
+
+  genRenderbuffers(1, &colorBuffer);
+  bindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+  renderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  genFramebuffers(1, &framebuffer);
+  bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                          GL_RENDERBUFFER, colorBuffer);
+  return true;
+}
+
+} // namespace
+
+bool CreateOffscreenContext(int width, int height, bool coreProfile) {
+  display = OpenDisplay();
+  if (display == EGL_NO_DISPLAY) {
+    printf("Offscreen GL: no EGL display\n");
+    return false;
+  }
+  eglBindAPI(EGL_OPENGL_API);
+
+  EGLint attribs[] = {EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+                      EGL_RED_SIZE,        8,
+                      EGL_GREEN_SIZE,      8,
+                      EGL_BLUE_SIZE,       8,
+                      EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                      EGL_NONE};
+  EGLConfig config;
+  EGLint count = 0;
+  bool pbuffer = eglChooseConfig(display, attribs, &config, 1, &count) &&
+                 count > 0;
+  if (!pbuffer) {
+    attribs[1] = 0; // any config, drawn through an FBO instead
+    if (!eglChooseConfig(display, attribs, &config, 1, &count) || !count) {
+      printf("Offscreen GL: no suitable EGL config\n");
+      return false;
+    }
+  }
+
+  EGLint core[] = {EGL_CONTEXT_MAJOR_VERSION,
+                   3,
+                   EGL_CONTEXT_MINOR_VERSION,
+                   3,
+                   EGL_CONTEXT_OPENGL_PROFILE_MASK,
+                   EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                   EGL_NONE};
+  context = eglCreateContext(display, config, EGL_NO_CONTEXT,
+                             coreProfile ? core : nullptr);
+  if (context == EGL_NO_CONTEXT) {
+    printf("Offscreen GL: cannot create context (0x%x)\n", eglGetError());
+    return false;
+  }
+  if (pbuffer) {
+    EGLint size[] = {EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE};
+    surface = eglCreatePbufferSurface(display, config, size);
+  }
+  if (!eglMakeCurrent(display, surface, surface, context)) {
+    printf("Offscreen GL: cannot make context current (0x%x)\n",
+           eglGetError());
+    return false;
+  }
+  if (surface == EGL_NO_SURFACE && !CreateFramebuffer(width, height)) {
+    printf("Offscreen GL: no framebuffer objects\n");
+    return false;
+  }
+
+  glViewport(0, 0, width, height);
+  printf("Offscreen GL: %s, %s\n", (const char *)glGetString(GL_RENDERER),
+         (const char *)glGetString(GL_VERSION));
+  return true;
+}
+
+void DestroyOffscreenContext() {
+  if (display == EGL_NO_DISPLAY)
+    return;
+  eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+  if (surface != EGL_NO_SURFACE)
+    eglDestroySurface(display, surface);
+  if (context != EGL_NO_CONTEXT)
+    eglDestroyContext(display, context);
+  eglTerminate(display);
+  display = EGL_NO_DISPLAY;
+  context = EGL_NO_CONTEXT;
+  surface = EGL_NO_SURFACE;
+}
@@ -0,0 +1,15 @@
+// Windowless GL context through EGL, used instead of glutCreateWindow for
+// headless and benchmark runs. Mesa's surfaceless platform needs neither an
+// X server nor a GPU (it falls back to llvmpipe), so the real GL path can be
+// rendered and timed anywhere.
+#ifndef OFFSCREEN_GL_H
+#define OFFSCREEN_GL_H
+
+// Makes a width x height GL context current on the calling thread, a GL 3.3
+// core profile one if coreProfile is set. Prints the reason and returns
+// false if no EGL display or config is available or the driver cannot
+// create such a context.
+bool CreateOffscreenContext(int width, int height, bool coreProfile = false);
+void DestroyOffscreenContext();
+
+#endif
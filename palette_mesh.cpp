@@ -0,0 +1,60 @@
+#include "palette_mesh.h"
+
+#include "engine.h"
+
+void PaletteMesh::AddTriangle(float x1, float y1, float x2, float y2,
+                              float x3, float y3, int color) {
+  parts.push_back({false, {x1, y1, x2, y2, x3, y3}, color});
+  Release();
+}
+
+void PaletteMesh::AddRectangle(float x, float y, float w, float h,
+                               int color) {
+  AddTriangle(x, y, x + w, y, x + w, y + h, color);
+  AddTriangle(x, y, x + w, y + h, x, y + h, color);
+}
+
+void PaletteMesh::AddCircle(float cx, float cy, float r, int color) {
+  parts.push_back({true, {cx, cy, r}, color});
+  Release();
+}
+
+void PaletteMesh::Draw(float x, float y, const PaletteColor *palette,
+                       int colors) {
+  if (backend != Renderer()) {
+    Release();
+    backend = Renderer();
+    handle = backend->CreateMesh(parts.data(), (int)parts.size());
+  }
+  if (backend->DrawMesh(handle, x, y, (const float *)palette, colors))
+    return;
+
+  for (const MeshPart &part : parts) {
+    const PaletteColor &c = palette[part.color];
+    if (c.a <= 0)
+      continue;
+    const float *v = part.xy;
+    if (part.circle)
+      drawCircle(x + v[0], y + v[1], v[2], c.r, c.g, c.b, c.a);
+    else
+      drawTriangle(x + v[0], y + v[1], x + v[2], y + v[3], x + v[4],
+                   y + v[5], c.r, c.g, c.b, c.a);
+  }
+}
+
+void PaletteMesh::Release() {
+  if (backend && handle)
+    backend->DestroyMesh(handle);
+  backend = nullptr;
+  handle = 0;
+}
+
+void BlendPalette(const PaletteColor *from, const PaletteColor *to, float t,
+                  int colors, PaletteColor *out) {
+  for (int i = 0; i < colors; i++) {
+    out[i].r = from[i].r + (to[i].r - from[i].r) * t;
+    out[i].g = from[i].g + (to[i].g - from[i].g) * t;
+    out[i].b = from[i].b + (to[i].b - from[i].b) * t;
+    out[i].a = from[i].a + (to[i].a - from[i].a) * t;
+  }
+}
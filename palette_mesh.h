@@ -0,0 +1,44 @@
+// Scenery recorded once with palette indices in place of colors. Drawing it
+// with another palette recolors it, so a season change, or a fade between
+// two seasons, is a new palette and never new geometry. The GL backend keeps
+// the mesh in a vertex buffer and the palette in a uniform; other backends
+// replay the recorded parts.
+#ifndef PALETTE_MESH_H
+#define PALETTE_MESH_H
+
+#include "render_backend.h"
+
+#include <vector>
+
+// RGBA
+struct PaletteColor {
+  float r, g, b, a;
+};
+
+class PaletteMesh {
+public:
+  // Color is an index below kMaxPaletteColors
+  void AddTriangle(float x1, float y1, float x2, float y2, float x3, float y3,
+                   int color);
+  void AddRectangle(float x, float y, float w, float h, int color);
+  void AddCircle(float cx, float cy, float r, int color);
+
+  // Moved by (x, y). Parts whose color is fully transparent are skipped
+  // when replayed.
+  void Draw(float x, float y, const PaletteColor *palette, int colors);
+
+private:
+  // Frees the handle on the backend it was created on
+  void Release();
+
+  std::vector<MeshPart> parts;
+  // Handle on the backend that was current at the first draw
+  RenderBackend *backend = nullptr;
+  int handle = 0;
+};
+
+// Component-wise from + (to - from) * t
+void BlendPalette(const PaletteColor *from, const PaletteColor *to, float t,
+                  int colors, PaletteColor *out);
+
+#endif
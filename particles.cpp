@@ -0,0 +1,181 @@
+#include "particles.h"
+
+#include "engine.h"
+#include "job_system.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+// Particles this far outside the window are gone for good
+const float kMargin = 50;
+const int kUpdateGrain = 4096;
+
+struct Streams {
+  float *x, *y, *vx, *vy, *age, *life, *weight, *drift;
+};
+
+void Integrate(const Streams &s, int begin, int end, float dt, float wind,
+               float gravity) {
+  const float minX = -kMargin, maxX = WINDOW_WIDTH + kMargin;
+  const float minY = -kMargin, maxY = WINDOW_HEIGHT + kMargin;
+  int i = begin;
+#ifdef __SSE2__
+  const __m128 dt4 = _mm_set1_ps(dt), wind4 = _mm_set1_ps(wind);
+  const __m128 fall4 = _mm_set1_ps(gravity * dt);
+  const __m128 minX4 = _mm_set1_ps(minX), maxX4 = _mm_set1_ps(maxX);
+  const __m128 minY4 = _mm_set1_ps(minY), maxY4 = _mm_set1_ps(maxY);
+  for (; i + 4 <= end; i += 4) {
+    __m128 vy = _mm_add_ps(_mm_loadu_ps(s.vy + i),
+                           _mm_mul_ps(fall4, _mm_loadu_ps(s.weight + i)));
+    __m128 vx = _mm_add_ps(_mm_loadu_ps(s.vx + i),
+                           _mm_mul_ps(wind4, _mm_loadu_ps(s.drift + i)));
+    __m128 x = _mm_add_ps(_mm_loadu_ps(s.x + i), _mm_mul_ps(vx, dt4));
+    __m128 y = _mm_add_ps(_mm_loadu_ps(s.y + i), _mm_mul_ps(vy, dt4));
+    __m128 age = _mm_add_ps(_mm_loadu_ps(s.age + i), dt4);
+
+    // Leaving the window ends a particle's life
+    __m128 out = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(x, minX4),
+                                     _mm_cmpgt_ps(x, maxX4)),
+                           _mm_or_ps(_mm_cmplt_ps(y, minY4),
+                                     _mm_cmpgt_ps(y, maxY4)));
+    age = _mm_or_ps(_mm_andnot_ps(out, age),
+                    _mm_and_ps(out, _mm_loadu_ps(s.life + i)));
+
+    _mm_storeu_ps(s.vy + i, vy);
+    _mm_storeu_ps(s.x + i, x);
+    _mm_storeu_ps(s.y + i, y);
+    _mm_storeu_ps(s.age + i, age);
+  }
+#endif
+  for (; i < end; i++) {
+    s.vy[i] += gravity * dt * s.weight[i];
+    s.x[i] += (s.vx[i] + wind * s.drift[i]) * dt;
+    s.y[i] += s.vy[i] * dt;
+    s.age[i] += dt;
+    if (s.x[i] < minX || s.x[i] > maxX || s.y[i] < minY || s.y[i] > maxY)
+      s.age[i] = s.life[i];
+  }
+}
+
+} // namespace
+
+ParticleSystem::ParticleSystem(int capacity) : capacity(capacity) {}
+
+ParticleSystem &ParticleSystem::operator=(const ParticleSystem &other) {
+  if (this == &other)
+    return *this;
+  capacity = other.capacity;
+  random = other.random;
+  if (other.Count() > 0)
+    Reserve();
+  x = other.x;
+  y = other.y;
+  vx = other.vx;
+  vy = other.vy;
+  age = other.age;
+  life = other.life;
+  size = other.size;
+  weight = other.weight;
+  drift = other.drift;
+  color = other.color;
+  return *this;
+}
+
+void ParticleSystem::Reserve() {
+  if (x.capacity() >= (size_t)capacity)
+    return;
+  for (std::vector<float> *stream :
+       {&x, &y, &vx, &vy, &age, &life, &size, &weight, &drift})
+    stream->reserve(capacity);
+  color.reserve(capacity);
+}
+
+void ParticleSystem::Clear() {
+  for (std::vector<float> *stream :
+       {&x, &y, &vx, &vy, &age, &life, &size, &weight, &drift})
+    stream->clear();
+  color.clear();
+}
+
+void ParticleSystem::Spawn(const ParticleEmitter &emitter, int count) {
+  Reserve();
+  count = std::min(count, capacity - Count());
+  if (count <= 0)
+    return;
+  int first = Count();
+  for (std::vector<float> *stream :
+       {&x, &y, &vx, &vy, &age, &life, &size, &weight, &drift})
+    stream->resize(first + count);
+  color.resize(first + count);
+
+  random.Fill(&x[first], count, emitter.x0, emitter.x1);
+  random.Fill(&y[first], count, emitter.y0, emitter.y1);
+  random.Fill(&vx[first], count, emitter.vx0, emitter.vx1);
+  random.Fill(&vy[first], count, emitter.vy0, emitter.vy1);
+  random.Fill(&life[first], count, emitter.life0, emitter.life1);
+  random.Fill(&size[first], count, emitter.size0, emitter.size1);
+  std::fill(weight.begin() + first, weight.end(), emitter.weight);
+  std::fill(drift.begin() + first, drift.end(), emitter.drift);
+
+  // The age stream holds the brightness rolls until it is zeroed
+  random.Fill(&age[first], count, 1 - emitter.shade, 1);
+  for (int i = first; i < first + count; i++) {
+    float shade = age[i];
+    uint8_t rgba[4] = {(uint8_t)(emitter.r * shade * 255 + 0.5f),
+                       (uint8_t)(emitter.g * shade * 255 + 0.5f),
+                       (uint8_t)(emitter.b * shade * 255 + 0.5f), 255};
+    memcpy(&color[i], rgba, 4);
+  }
+  std::fill(age.begin() + first, age.end(), 0.0f);
+}
+
+void ParticleSystem::Emit(const ParticleEmitter &emitter, float dt,
+                          float &carry) {
+  carry += emitter.rate * dt;
+  int count = (int)carry;
+  carry -= count;
+  if (count > 0)
+    Spawn(emitter, count);
+}
+
+void ParticleSystem::Update(float dt, float wind, float gravity) {
+  int count = Count();
+  if (count == 0)
+    return;
+  Streams s = {x.data(),   y.data(),    vx.data(),     vy.data(),
+               age.data(), life.data(), weight.data(), drift.data()};
+  ParallelFor(count, kUpdateGrain, [&](int begin, int end) {
+    Integrate(s, begin, end, dt, wind, gravity);
+  });
+
+  // Expired particles swap with the last live one
+  for (int i = 0; i < count;) {
+    if (age[i] < life[i]) {
+      i++;
+      continue;
+    }
+    count--;
+    for (std::vector<float> *stream :
+         {&x, &y, &vx, &vy, &age, &life, &size, &weight, &drift})
+      (*stream)[i] = (*stream)[count];
+    color[i] = color[count];
+  }
+  for (std::vector<float> *stream :
+       {&x, &y, &vx, &vy, &age, &life, &size, &weight, &drift})
+    stream->resize(count);
+  color.resize(count);
+}
+
+void ParticleSystem::Draw() const {
+  for (int i = 0; i < Count(); i++) {
+    const uint8_t *rgba = (const uint8_t *)&color[i];
+    drawCircle(x[i], y[i], size[i], rgba[0] / 255.0f, rgba[1] / 255.0f,
+               rgba[2] / 255.0f);
+  }
+}
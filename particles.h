@@ -0,0 +1,60 @@
+// Weather particles: spring petals, summer embers, autumn leaves and winter
+// snow. Each attribute is its own array, so the update integrates four
+// particles per SSE instruction and splits across the job system; expired
+// particles are swapped out in one pass afterwards.
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include "random.h"
+
+#include <cstdint>
+#include <vector>
+
+// Particles start uniformly inside the spawn box with velocity, lifetime,
+// size and brightness drawn from the given ranges. Velocities are pixels per
+// second; weight scales gravity and drift scales the wind.
+struct ParticleEmitter {
+  float x0, x1, y0, y1;
+  float vx0, vx1, vy0, vy1;
+  float life0, life1;
+  float size0, size1;
+  float weight, drift;
+  float r, g, b;
+  float shade; // brightness varies from 1 - shade to 1
+  float rate;  // particles per second
+};
+
+class ParticleSystem {
+public:
+  explicit ParticleSystem(int capacity = 1024);
+  ParticleSystem(const ParticleSystem &other) = default;
+  // Reserves the full capacity before copying, so repeated copies into the
+  // same system (per-tick snapshots) never reallocate as the count varies
+  ParticleSystem &operator=(const ParticleSystem &other);
+
+  int Count() const { return (int)x.size(); }
+  void Clear();
+  void Seed(const Random &seed) { random = RandomLanes(seed); }
+
+  // Spawns count particles at once, fewer if the system is full
+  void Spawn(const ParticleEmitter &emitter, int count);
+  // Spawns rate * dt particles; carry keeps the fraction for the next call
+  void Emit(const ParticleEmitter &emitter, float dt, float &carry);
+
+  // Accelerates by gravity * weight, moves by velocity plus wind * drift,
+  // then removes particles that outlived their lifetime or left the window
+  void Update(float dt, float wind, float gravity);
+
+  void Draw() const;
+
+private:
+  void Reserve();
+
+  int capacity;
+  RandomLanes random; // fills a whole spawn batch per attribute
+  // Storage is reserved on the first spawn, so empty systems cost nothing
+  std::vector<float> x, y, vx, vy, age, life, size, weight, drift;
+  std::vector<uint32_t> color; // RGBA bytes
+};
+
+#endif
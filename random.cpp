@@ -0,0 +1,141 @@
+#include "random.h"
+
+#include <algorithm>
+#include <ctime>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// Unseeded runs still differ from one launch to the next
+uint64_t runSeed = (uint64_t)time(nullptr);
+
+uint64_t SplitMix64(uint64_t &x) {
+  uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+inline uint32_t Rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+inline uint32_t Step(uint32_t &s0, uint32_t &s1, uint32_t &s2, uint32_t &s3) {
+  uint32_t result = Rotl(s1 * 5, 7) * 9;
+  uint32_t t = s1 << 9;
+  s2 ^= s0;
+  s3 ^= s1;
+  s1 ^= s2;
+  s0 ^= s3;
+  s2 ^= t;
+  s3 = Rotl(s3, 11);
+  return result;
+}
+
+inline float ToUnit(uint32_t bits) { return (bits >> 8) * (1.0f / 16777216.0f); }
+
+void ApplyJump(uint32_t s[4], const uint32_t polynomial[4]) {
+  uint32_t jumped[4] = {0, 0, 0, 0};
+  for (int i = 0; i < 4; i++)
+    for (int b = 0; b < 32; b++) {
+      if (polynomial[i] & (1u << b))
+        for (int w = 0; w < 4; w++)
+          jumped[w] ^= s[w];
+      Step(s[0], s[1], s[2], s[3]);
+    }
+  std::copy(jumped, jumped + 4, s);
+}
+
+const uint32_t kJump[4] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
+const uint32_t kLongJump[4] = {0xb523952e, 0x0b6f099f, 0xccf5a0ef,
+                               0x1c580662};
+
+} // namespace
+
+// ===== Random =====
+Random::Random(uint64_t seed) {
+  uint64_t a = SplitMix64(seed), b = SplitMix64(seed);
+  s[0] = (uint32_t)a;
+  s[1] = (uint32_t)(a >> 32);
+  s[2] = (uint32_t)b;
+  s[3] = (uint32_t)(b >> 32);
+}
+
+uint32_t Random::Next() { return Step(s[0], s[1], s[2], s[3]); }
+
+float Random::Uniform() { return ToUnit(Next()); }
+
+void Random::Jump() { ApplyJump(s, kJump); }
+
+void Random::LongJump() { ApplyJump(s, kLongJump); }
+
+// ===== RandomLanes =====
+RandomLanes::RandomLanes(Random base) {
+  for (int lane = 0; lane < 4; lane++) {
+    for (int w = 0; w < 4; w++)
+      s[w][lane] = base.s[w];
+    base.Jump();
+  }
+}
+
+void RandomLanes::Fill(float *out, int count, float low, float high) {
+  const float scale = (high - low) * (1.0f / 16777216.0f);
+#ifdef __SSE2__
+  __m128i s0 = _mm_load_si128((const __m128i *)s[0]);
+  __m128i s1 = _mm_load_si128((const __m128i *)s[1]);
+  __m128i s2 = _mm_load_si128((const __m128i *)s[2]);
+  __m128i s3 = _mm_load_si128((const __m128i *)s[3]);
+  const __m128 low4 = _mm_set1_ps(low), scale4 = _mm_set1_ps(scale);
+  for (int i = 0; i < count; i += 4) {
+    // rotl(s1 * 5, 7) * 9, with the multiplies as shift and add
+    __m128i x = _mm_add_epi32(s1, _mm_slli_epi32(s1, 2));
+    x = _mm_or_si128(_mm_slli_epi32(x, 7), _mm_srli_epi32(x, 25));
+    x = _mm_add_epi32(x, _mm_slli_epi32(x, 3));
+
+    __m128i t = _mm_slli_epi32(s1, 9);
+    s2 = _mm_xor_si128(s2, s0);
+    s3 = _mm_xor_si128(s3, s1);
+    s1 = _mm_xor_si128(s1, s2);
+    s0 = _mm_xor_si128(s0, s3);
+    s2 = _mm_xor_si128(s2, t);
+    s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+    __m128 value = _mm_add_ps(
+        low4, _mm_mul_ps(scale4, _mm_cvtepi32_ps(_mm_srli_epi32(x, 8))));
+    if (i + 4 <= count) {
+      _mm_storeu_ps(out + i, value);
+    } else {
+      alignas(16) float tail[4];
+      _mm_store_ps(tail, value);
+      std::copy(tail, tail + (count - i), out + i);
+    }
+  }
+  _mm_store_si128((__m128i *)s[0], s0);
+  _mm_store_si128((__m128i *)s[1], s1);
+  _mm_store_si128((__m128i *)s[2], s2);
+  _mm_store_si128((__m128i *)s[3], s3);
+#else
+  // Same lane order as the SSE path, so both give the same numbers
+  for (int i = 0; i < count; i += 4)
+    for (int lane = 0; lane < 4; lane++) {
+      uint32_t bits = Step(s[0][lane], s[1][lane], s[2][lane], s[3][lane]);
+      if (i + lane < count)
+        out[i + lane] = low + scale * (bits >> 8);
+    }
+#endif
+}
+
+// ===== Streams =====
+void SetRandomSeed(uint64_t seed) { runSeed = seed; }
+
+uint64_t RandomSeed() { return runSeed; }
+
+Random NewRandom(RandomStream stream, int index) {
+  Random random(runSeed);
+  for (int i = 0; i < (int)stream; i++)
+    random.LongJump();
+  for (int i = 0; i < index; i++)
+    random.Jump();
+  return random;
+}
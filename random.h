@@ -0,0 +1,59 @@
+// Seedable random number streams. Each subsystem draws from its own
+// xoshiro128** generator derived from the run's seed (--seed), so what one
+// subsystem draws never shifts another's sequence and a seeded run replays
+// exactly. Streams are separated by jumping ahead, which also gives
+// independent generators to work running in parallel.
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+class Random {
+public:
+  // The four state words come from splitmix64 of the seed
+  explicit Random(uint64_t seed = 0);
+
+  uint32_t Next();
+  float Uniform(); // [0, 1) in steps of 2^-24
+  float Uniform(float low, float high) { return low + (high - low) * Uniform(); }
+  int Below(int n) { return (int)(((uint64_t)Next() * (uint32_t)n) >> 32); }
+
+  // Advance by 2^64 and 2^96 draws
+  void Jump();
+  void LongJump();
+
+private:
+  friend class RandomLanes;
+  uint32_t s[4];
+};
+
+// Four generators stepped side by side, one per SSE lane, for filling whole
+// arrays at once. Lane k is the base generator jumped ahead k times.
+class RandomLanes {
+public:
+  explicit RandomLanes(Random base = Random());
+
+  // Writes count uniform floats in [low, high)
+  void Fill(float *out, int count, float low, float high);
+
+private:
+  alignas(16) uint32_t s[4][4]; // state word, then lane
+};
+
+// One stream per subsystem that draws random numbers
+enum RandomStream {
+  RANDOM_SCENERY, // clouds and fire flicker
+  RANDOM_WEATHER, // particle spawns
+  RANDOM_ITEMS,   // the game's falling items
+};
+
+// The run's seed; set it before any scene draws, e.g. from --seed
+void SetRandomSeed(uint64_t seed);
+uint64_t RandomSeed();
+
+// The generator for a subsystem: the run's seed long-jumped stream times,
+// then jumped index times for each of its parallel users. The same
+// arguments always give the same sequence.
+Random NewRandom(RandomStream stream, int index = 0);
+
+#endif
@@ -0,0 +1,141 @@
+// Where the drawing helpers send their primitives. The GL backend issues
+// the original immediate-mode calls; the GL 3.3 backend draws the same
+// frames in a core profile, from vertex buffers and shaders only; the
+// software backend rasterizes into a CPU framebuffer so frames can be
+// rendered with no GPU or X server.
+#ifndef RENDER_BACKEND_H
+#define RENDER_BACKEND_H
+
+#include "assets.h"
+
+#include <GL/gl.h>
+#include <vector>
+
+enum Primitive { PRIM_TRIANGLES, PRIM_TRIANGLE_FAN, PRIM_QUADS };
+
+// Shapes filled from a signed distance evaluated per pixel, in their own
+// units: circles have radius 1, a bowl is the half of that circle below its
+// center, and the heart is drawHeart's outline at size 1
+enum Shape { SHAPE_CIRCLE, SHAPE_BOWL, SHAPE_HEART };
+
+// Right half of drawHeart's outline at size 1, x, y pairs from the notch
+// at (0, -5) round to the point at (0, 17). The left half is its mirror.
+const int kHeartOutlinePoints = 65;
+const float *HeartOutline(); // engine.cpp
+
+// The outdoor backdrop in window pixels: sky above the horizon, ground
+// below it, the sun on the parabola y = a (x - h)^2 + k given as
+// sunCurve {a, h, k}, and clouds drawn over both
+struct SkyLayer {
+  float sky[3], ground[3];
+  float horizon;
+  bool sun;
+  float sunX, sunCurve[3];
+  int cloudCount;
+  float cloudX[3], cloudY[3];
+};
+
+// One piece of a retained mesh: a solid triangle, or a circle of the given
+// radius around (x, y). color indexes the palette the mesh is drawn with.
+struct MeshPart {
+  bool circle;
+  float xy[6]; // triangle corners, or x, y, radius
+  int color;
+};
+
+const int kMaxPaletteColors = 16;
+
+// What a frame cost in GL calls, for tracking regressions
+struct DrawStats {
+  int commands = 0;        // draws recorded through the backend
+  int drawCalls = 0;       // draw calls they were submitted as
+  int stateChanges = 0;    // program, texture or primitive switches
+  int unsortedChanges = 0; // switches in the order they were recorded
+};
+
+class RenderBackend {
+public:
+  virtual ~RenderBackend() {}
+
+  virtual const char *Name() const = 0;
+
+  // Clears to the given color; every frame starts here
+  virtual void BeginFrame(float r, float g, float b) = 0;
+  // All drawing for the frame is complete once this returns
+  virtual void EndFrame() = 0;
+  // Counts for the frame last ended, where the backend keeps them
+  virtual DrawStats LastDrawStats() const { return DrawStats(); }
+
+  // Maps (left..right, bottom..top) onto the whole framebuffer until the
+  // matching pop; the default is window pixels
+  virtual void PushProjection(float left, float right, float bottom,
+                              float top) = 0;
+  virtual void PopProjection() = 0;
+
+  // Solid-colored geometry, vertices as x, y pairs. Blending is always
+  // SRC_ALPHA, ONE_MINUS_SRC_ALPHA.
+  virtual void FillPrimitive(Primitive primitive, const float *xy, int count,
+                             float r, float g, float b, float a) = 0;
+
+  // An antialiased shape scaled by size around (x, y), as one quad whatever
+  // its size. Returns false if the backend cannot, and the caller
+  // tessellates the shape instead.
+  virtual bool FillShape(Shape /*shape*/, float /*x*/, float /*y*/,
+                         float /*size*/, float /*r*/, float /*g*/,
+                         float /*b*/, float /*a*/) {
+    return false;
+  }
+
+  // Keeps the parts for DrawMesh and returns their handle, or 0 if the
+  // backend does not retain geometry and the caller replays the parts
+  virtual int CreateMesh(const MeshPart * /*parts*/, int /*count*/) {
+    return 0;
+  }
+  // Frees a mesh from CreateMesh; its handle may be given out again
+  virtual void DestroyMesh(int /*mesh*/) {}
+  // Draws a retained mesh moved by (x, y), each part in palette[color],
+  // given as colors RGBA entries. Returns false for handle 0.
+  virtual bool DrawMesh(int /*mesh*/, float /*x*/, float /*y*/,
+                        const float * /*palette*/, int /*colors*/) {
+    return false;
+  }
+
+  // Image must stay alive as long as the texture is used
+  virtual GLuint CreateTexture(const Image &image) = 0;
+  virtual void DrawTexture(GLuint texture, float x, float y, float w,
+                           float h) = 0;
+
+  // Bitmap text with the baseline starting at (x, y), like glRasterPos
+  virtual void DrawText(const char *text, int length, float x, float y,
+                        void *font, float r, float g, float b) = 0;
+
+  // Draws the whole sky layer in one pass if the backend can. Returns false
+  // to have the caller draw it from primitives instead.
+  virtual bool DrawSky(const SkyLayer & /*sky*/) { return false; }
+
+  // The finished frame, RGBA, bottom row first
+  virtual void ReadFrame(std::vector<unsigned char> &rgba) = 0;
+
+  // Readback for capture without stalling the frame. QueueReadback starts
+  // copying the finished frame out; TakeReadback returns the oldest queued
+  // frame once its copy has landed, or false if none has yet. Frames come
+  // back in order, a few frames late on GL. With wait set, or when no slot
+  // is left for the next QueueReadback, TakeReadback blocks instead.
+  virtual void QueueReadback() = 0;
+  virtual bool TakeReadback(std::vector<unsigned char> &rgba, bool wait) = 0;
+};
+
+RenderBackend *Renderer();
+void SetRenderer(RenderBackend *renderer);
+
+// skyShader draws SkyLayer with a fragment program where GLSL is available.
+// immediate submits every draw on its own in recorded order, unsorted and
+// unbatched, as a baseline for the draw list.
+RenderBackend *CreateGLRenderer(bool skyShader = false,
+                                bool immediate = false); // gl_renderer.cpp
+RenderBackend *CreateSoftwareRenderer(int width, int height); // software_renderer.cpp
+// Needs a current GL 3.3 core (or newer) context; returns nullptr, having
+// said why, if the context cannot run it
+RenderBackend *CreateGL33Renderer(bool skyShader = false); // gl33_renderer.cpp
+
+#endif
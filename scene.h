@@ -0,0 +1,74 @@
+// Common interface implemented by the menu, every cutscene and the game
+#ifndef SCENE_H
+#define SCENE_H
+
+class Scene {
+public:
+  virtual ~Scene() {}
+
+  // How the scene changes, for render on demand. ANIMATING redraws every
+  // tick. TIMED still needs ticks but calls Invalidate when what it shows
+  // changes. STILL only changes in response to input, so the main loop can
+  // sleep until an event arrives.
+  enum Activity { ANIMATING, TIMED, STILL };
+
+  virtual const char *Name() const = 0;
+
+  // Runs on a background thread while the previous scene is still playing.
+  // Decode images and build any CPU-side data here; no GL calls.
+  virtual void Preload() {}
+
+  // Called on the GLUT thread when the scene becomes current
+  virtual void Enter() {}
+  virtual void Update(float dt) = 0;
+  virtual void Render() = 0;
+  virtual void Exit() {}
+
+  // The manager moves on to the next scene once this returns true
+  virtual bool IsFinished() const { return false; }
+
+  virtual Activity CurrentActivity() const { return ANIMATING; }
+
+  // Timeline-driven scenes can jump straight to time t (seconds since
+  // Enter) or to a named marker. Scenes without a timeline return false.
+  virtual bool Seek(float /*t*/) { return false; }
+  virtual bool FindMarker(const char * /*name*/, float & /*t*/) const {
+    return false;
+  }
+
+  virtual void HandleKeyPress(unsigned char /*key*/, int /*x*/, int /*y*/) {}
+  virtual void HandleKeyRelease(unsigned char /*key*/, int /*x*/, int /*y*/) {}
+  virtual void HandleSpecialKeyPress(int /*key*/, int /*x*/, int /*y*/) {}
+  virtual void HandleSpecialKeyRelease(int /*key*/, int /*x*/, int /*y*/) {}
+  virtual void HandleMouse(int /*button*/, int /*state*/, int /*x*/,
+                           int /*y*/) {}
+};
+
+// ===== Render on demand (scene_manager.cpp) =====
+// Off by default: every tick is drawn. When on, frames are drawn only for
+// ANIMATING scenes and after Invalidate, which is safe from any thread.
+void SetRenderOnDemand(bool enabled);
+bool RenderOnDemand();
+void Invalidate();
+
+// ===== Simulation clock (scene_manager.cpp) =====
+// A scene may simulate on its own thread against the wall clock only when
+// the loop runs in real time, in a window. Off, the default, everything
+// advances in Update, so a seeded --run-frames or --headless run draws the
+// same frames every time. Speed is the ticks per frame period either way.
+void SetRealTimeSimulation(bool enabled);
+bool RealTimeSimulation();
+void SetSimulationSpeed(int ticks);
+int SimulationSpeed();
+
+// ===== Scenes in story order =====
+Scene *CreateMenuScene();        // scene6.cpp
+Scene *CreateWoodsScene();       // scene6.cpp
+Scene *CreateHouseScene();       // scene2.cpp
+Scene *CreatePorridgeScene();    // scene3.cpp
+Scene *CreateBearsWakeScene();   // scene4.cpp
+Scene *CreateBearsDemandScene(); // scene5.cpp
+Scene *CreateNarrativeScene();   // narrative_transition.cpp
+Scene *CreateGameScene(bool bot = false); // game.cpp
+
+#endif
@@ -0,0 +1,147 @@
+#include "scene_manager.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+bool onDemand = false;
+bool realTime = false;
+int speed = 1;
+std::atomic<bool> invalidated{true};
+
+} // namespace
+
+void SetRenderOnDemand(bool enabled) { onDemand = enabled; }
+
+bool RenderOnDemand() { return onDemand; }
+
+void Invalidate() { invalidated.store(true, std::memory_order_release); }
+
+void SetRealTimeSimulation(bool enabled) { realTime = enabled; }
+
+bool RealTimeSimulation() { return realTime; }
+
+void SetSimulationSpeed(int ticks) { speed = ticks; }
+
+int SimulationSpeed() { return speed; }
+
+SceneManager::~SceneManager() {
+  for (auto &preload : preloads)
+    Wait(*preload);
+  if (Current())
+    Current()->Exit();
+}
+
+void SceneManager::Add(Scene *scene) {
+  scenes.emplace_back(scene);
+  preloads.emplace_back(new JobCounter());
+  preloadStarted.push_back(false);
+}
+
+void SceneManager::Start(int index) {
+  BeginPreload(index);
+  Wait(*preloads[index]); // nothing is on screen yet, so blocking is fine
+  SwitchTo(index);
+}
+
+int SceneManager::Find(const char *name) const {
+  for (int i = 0; i < (int)scenes.size(); i++)
+    if (strcmp(scenes[i]->Name(), name) == 0)
+      return i;
+  return -1;
+}
+
+bool SceneManager::Seek(const char *spec) {
+  Scene *scene = Current();
+  if (!scene)
+    return false;
+
+  char *end;
+  float t = strtof(spec, &end);
+  if (end == spec || *end != '\0') {
+    if (!scene->FindMarker(spec, t))
+      return false;
+  }
+  return scene->Seek(t);
+}
+
+Scene *SceneManager::Current() const {
+  return current >= 0 ? scenes[current].get() : nullptr;
+}
+
+void SceneManager::BeginPreload(int index) {
+  if (index < 0 || index >= (int)scenes.size() || preloadStarted[index])
+    return;
+  preloadStarted[index] = true;
+  Scene *scene = scenes[index].get();
+  SubmitBackground(*preloads[index], [scene]() { scene->Preload(); });
+}
+
+bool SceneManager::IsPreloaded(int index) {
+  return preloads[index]->Done();
+}
+
+void SceneManager::SwitchTo(int index) {
+  if (Current())
+    Current()->Exit();
+  current = index;
+  Current()->Enter();
+  Invalidate();
+
+  // Start on the next scene while this one plays
+  BeginPreload(current + 1);
+}
+
+void SceneManager::Update(float dt) {
+  Scene *scene = Current();
+  if (!scene)
+    return;
+  scene->Update(dt);
+
+  // Keep playing the current scene until the next one is ready rather than
+  // stalling the frame on a half-finished preload
+  int next = current + 1;
+  if (scene->IsFinished() && next < (int)scenes.size() && IsPreloaded(next))
+    SwitchTo(next);
+}
+
+void SceneManager::Render() {
+  if (Current())
+    Current()->Render();
+}
+
+Scene::Activity SceneManager::CurrentActivity() const {
+  return Current() ? Current()->CurrentActivity() : Scene::STILL;
+}
+
+bool SceneManager::TakeRedraw() {
+  bool redraw = invalidated.exchange(false, std::memory_order_acq_rel);
+  return redraw || !onDemand || CurrentActivity() == Scene::ANIMATING;
+}
+
+void SceneManager::HandleKeyPress(unsigned char key, int x, int y) {
+  if (Current())
+    Current()->HandleKeyPress(key, x, y);
+}
+
+void SceneManager::HandleKeyRelease(unsigned char key, int x, int y) {
+  if (Current())
+    Current()->HandleKeyRelease(key, x, y);
+}
+
+void SceneManager::HandleSpecialKeyPress(int key, int x, int y) {
+  if (Current())
+    Current()->HandleSpecialKeyPress(key, x, y);
+}
+
+void SceneManager::HandleSpecialKeyRelease(int key, int x, int y) {
+  if (Current())
+    Current()->HandleSpecialKeyRelease(key, x, y);
+}
+
+void SceneManager::HandleMouse(int button, int state, int x, int y) {
+  if (Current())
+    Current()->HandleMouse(button, state, x, y);
+}
@@ -0,0 +1,53 @@
+// Plays scenes in order and preloads the next one as a background job so a
+// transition never has to wait on image decoding.
+#ifndef SCENE_MANAGER_H
+#define SCENE_MANAGER_H
+
+#include "job_system.h"
+#include "scene.h"
+
+#include <memory>
+#include <vector>
+
+class SceneManager {
+public:
+  ~SceneManager();
+
+  // Takes ownership; scenes play in the order they are added
+  void Add(Scene *scene);
+  void Start(int index = 0);
+
+  // Index of the scene with the given Name(), or -1
+  int Find(const char *name) const;
+
+  // Jumps the current scene to a time in seconds ("12.5") or to one of its
+  // markers ("just_right"). Returns false if the scene cannot seek there.
+  bool Seek(const char *spec);
+
+  void Update(float dt);
+  void Render();
+
+  Scene::Activity CurrentActivity() const;
+  // Whether the next frame must be drawn; clears the invalidation
+  bool TakeRedraw();
+
+  Scene *Current() const;
+
+  void HandleKeyPress(unsigned char key, int x, int y);
+  void HandleKeyRelease(unsigned char key, int x, int y);
+  void HandleSpecialKeyPress(int key, int x, int y);
+  void HandleSpecialKeyRelease(int key, int x, int y);
+  void HandleMouse(int button, int state, int x, int y);
+
+private:
+  void BeginPreload(int index);
+  bool IsPreloaded(int index);
+  void SwitchTo(int index);
+
+  std::vector<std::unique_ptr<Scene>> scenes;
+  std::vector<std::unique_ptr<JobCounter>> preloads;
+  std::vector<bool> preloadStarted;
+  int current = -1;
+};
+
+#endif
@@ -0,0 +1,827 @@
+// CPU rasterizer. Drawing calls are recorded as commands and binned into
+// 64x64 tiles; EndFrame() rasterizes the tiles in parallel on the job
+// system, each tile replaying its commands in submission order so blending
+// matches GL exactly as if drawn serially. Coverage follows GL's rules:
+// pixel centers, with a tie-break so shared triangle edges are filled once.
+#include "render_backend.h"
+
+#include "bitmap_font.h"
+#include "job_system.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+const int kTileSize = 64;
+const int kBinReserve = 256; // commands per tile
+
+// =============================================================================
+// Span filling
+// =============================================================================
+
+// A color ready for SRC_ALPHA, ONE_MINUS_SRC_ALPHA: out = src * a + dst * inv
+struct Paint {
+  uint32_t packed; // RGBA bytes, used as-is when opaque
+  bool opaque;
+  uint16_t src[4]; // channel * alpha; alpha's own lane keeps the buffer opaque
+  uint16_t inv;    // 255 - alpha
+};
+
+Paint MakePaint(float r, float g, float b, float a) {
+  auto byte = [](float v) {
+    return (uint8_t)(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f);
+  };
+  uint8_t rgba[4] = {byte(r), byte(g), byte(b), 255};
+  uint8_t alpha = byte(a);
+
+  Paint paint;
+  memcpy(&paint.packed, rgba, 4);
+  paint.opaque = alpha == 255;
+  for (int i = 0; i < 4; i++)
+    paint.src[i] = rgba[i] * alpha;
+  paint.inv = 255 - alpha;
+  return paint;
+}
+
+inline uint32_t Div255(uint32_t x) { return (x + 128 + ((x + 128) >> 8)) >> 8; }
+
+inline void BlendPixel(uint32_t *dst, const uint16_t src[4], uint32_t inv) {
+  uint8_t *bytes = (uint8_t *)dst;
+  for (int i = 0; i < 4; i++)
+    bytes[i] = (uint8_t)Div255(src[i] + bytes[i] * inv);
+}
+
+void FillSpan(uint32_t *dst, int count, const Paint &paint) {
+  int i = 0;
+#ifdef __SSE2__
+  if (paint.opaque) {
+    __m128i color = _mm_set1_epi32((int)paint.packed);
+    for (; i + 4 <= count; i += 4)
+      _mm_storeu_si128((__m128i *)(dst + i), color);
+  } else {
+    // Two pixels per 16-bit register: widen, multiply-add, divide by 255
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i src = _mm_setr_epi16(
+        paint.src[0], paint.src[1], paint.src[2], paint.src[3], paint.src[0],
+        paint.src[1], paint.src[2], paint.src[3]);
+    const __m128i inv = _mm_set1_epi16(paint.inv);
+    auto blend = [&](__m128i dst16) {
+      __m128i x = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(dst16, inv), src),
+                                bias);
+      return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+    };
+    for (; i + 4 <= count; i += 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i));
+      __m128i lo = blend(_mm_unpacklo_epi8(pixels, zero));
+      __m128i hi = blend(_mm_unpackhi_epi8(pixels, zero));
+      _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+  }
+#endif
+  if (paint.opaque) {
+    for (; i < count; i++)
+      dst[i] = paint.packed;
+  } else {
+    for (; i < count; i++)
+      BlendPixel(dst + i, paint.src, paint.inv);
+  }
+}
+
+// =============================================================================
+// Commands
+// =============================================================================
+
+struct TextureQuad {
+  const Image *image;
+  float x, y, w, h; // window coordinates
+};
+
+// Pixel (x, y) maps to shape units ((x - cx) * unitsX, (y - cy) * unitsY);
+// pixel is one pixel's size in shape units for antialiasing
+struct ShapeQuad {
+  Shape shape;
+  float cx, cy;
+  float unitsX, unitsY, pixel;
+  uint8_t rgb[3], alpha;
+};
+
+struct GlyphBitmap {
+  const unsigned char *rows;
+  int width, height;
+  int x, y; // lower-left pixel
+};
+
+// One side of a counter-clockwise triangle, set up once so each row costs a
+// multiply-add. Shared edges appear with opposite directions in their two
+// triangles, and exactly one side covers pixel centers lying on the edge.
+struct Edge {
+  float x, y, slope; // the edge crosses row center yc at x + slope * (yc - y)
+  int side;          // +1: inside is right of the edge, -1: left, 0: flat
+  bool inclusive;
+};
+
+// Convex fans and quads skip triangulation: each row takes its span from
+// one left and one right edge, stored bottom to top in a per-frame pool
+struct PolygonEdge {
+  Edge edge;
+  float ymin, ymax;
+};
+
+struct PolygonRef {
+  int first; // into the edge pool; left chain then right chain
+  int leftCount, rightCount;
+};
+
+struct Command {
+  enum Type { TRIANGLE, POLYGON, TEXTURE, GLYPH, SHAPE } type;
+  int x0, y0, x1, y1; // pixels that may be touched, [x0, x1) x [y0, y1)
+  Paint paint;
+  union {
+    Edge edges[3];
+    PolygonRef polygon;
+    TextureQuad texture;
+    GlyphBitmap glyph;
+    ShapeQuad shape;
+  };
+};
+
+struct Tile {
+  int x0, y0, x1, y1;
+  uint32_t *pixels; // framebuffer origin
+  int stride;
+};
+
+// std::ceil/floor are library calls without SSE4.1; bounds here stay small
+inline int Ceil(float x) {
+  int i = (int)x;
+  return i + (x > i);
+}
+inline int Floor(float x) {
+  int i = (int)x;
+  return i - (x < i);
+}
+
+Edge MakeEdge(float px, float py, float qx, float qy) {
+  Edge edge;
+  edge.x = px;
+  edge.y = py;
+  edge.inclusive = qy < py || (qy == py && qx < px);
+  if (qy == py) {
+    // Flat: inside is above the edge when it runs left to right; slope just
+    // carries that direction
+    edge.side = 0;
+    edge.slope = qx > px ? 1.0f : -1.0f;
+  } else {
+    edge.slope = (qx - px) / (qy - py);
+    edge.side = qy < py ? 1 : -1;
+  }
+  return edge;
+}
+
+// Narrows [left, right] to the pixels whose centers are inside the edge
+inline void ClipSpan(const Edge &edge, float yc, int &left, int &right) {
+  if (edge.side == 0) {
+    float d = (yc - edge.y) * edge.slope; // > 0 inside
+    if (d < 0 || (d == 0 && !edge.inclusive))
+      right = left - 1;
+    return;
+  }
+  float bound = edge.x + edge.slope * (yc - edge.y) - 0.5f;
+  bound = std::min(std::max(bound, -1e6f), 1e6f);
+  if (edge.side > 0)
+    left = std::max(left, edge.inclusive ? Ceil(bound) : Floor(bound) + 1);
+  else
+    right = std::min(right, edge.inclusive ? Floor(bound) : Ceil(bound) - 1);
+}
+
+void RasterTriangle(const Command &cmd, const Tile &tile) {
+  int x0 = std::max(cmd.x0, tile.x0), x1 = std::min(cmd.x1, tile.x1);
+  int y0 = std::max(cmd.y0, tile.y0), y1 = std::min(cmd.y1, tile.y1);
+
+  for (int y = y0; y < y1; y++) {
+    float yc = y + 0.5f;
+    int left = x0, right = x1 - 1;
+    ClipSpan(cmd.edges[0], yc, left, right);
+    ClipSpan(cmd.edges[1], yc, left, right);
+    ClipSpan(cmd.edges[2], yc, left, right);
+    if (left <= right)
+      FillSpan(tile.pixels + y * tile.stride + left, right - left + 1,
+               cmd.paint);
+  }
+}
+
+void RasterPolygon(const Command &cmd, const Tile &tile,
+                   const PolygonEdge *pool) {
+  int x0 = std::max(cmd.x0, tile.x0), x1 = std::min(cmd.x1, tile.x1);
+  int y0 = std::max(cmd.y0, tile.y0), y1 = std::min(cmd.y1, tile.y1);
+  const PolygonEdge *left = pool + cmd.polygon.first;
+  const PolygonEdge *right = left + cmd.polygon.leftCount;
+  int l = 0, r = 0;
+
+  for (int y = y0; y < y1; y++) {
+    float yc = y + 0.5f;
+    while (l + 1 < cmd.polygon.leftCount && left[l].ymax <= yc)
+      l++;
+    while (r + 1 < cmd.polygon.rightCount && right[r].ymax <= yc)
+      r++;
+    int from = x0, to = x1 - 1;
+    ClipSpan(left[l].edge, yc, from, to);
+    ClipSpan(right[r].edge, yc, from, to);
+    if (from <= to)
+      FillSpan(tile.pixels + y * tile.stride + from, to - from + 1,
+               cmd.paint);
+  }
+}
+
+// Counter-clockwise and convex, allowing collinear points; rules out
+// self-intersecting stars by requiring y to turn around at most twice
+bool IsConvex(const float *v, int n) {
+  int turns = 0;
+  float lastDy = 0;
+  for (int i = 0; i < n; i++) {
+    const float *a = v + i * 2, *b = v + ((i + 1) % n) * 2,
+                *c = v + ((i + 2) % n) * 2;
+    float cross = (b[0] - a[0]) * (c[1] - b[1]) - (b[1] - a[1]) * (c[0] - b[0]);
+    if (cross < 0)
+      return false;
+    float dy = b[1] - a[1];
+    if (dy != 0) {
+      if (lastDy != 0 && (dy > 0) != (lastDy > 0))
+        turns++;
+      lastDy = dy;
+    }
+  }
+  return turns <= 2;
+}
+
+// Bilinear, clamped to the edge, modulated by white and blended by the
+// texel's alpha like the GL path
+void RasterTexture(const Command &cmd, const Tile &tile) {
+  const TextureQuad &quad = cmd.texture;
+  const Image &image = *quad.image;
+  int x0 = std::max(cmd.x0, tile.x0), x1 = std::min(cmd.x1, tile.x1);
+  int y0 = std::max(cmd.y0, tile.y0), y1 = std::min(cmd.y1, tile.y1);
+
+  for (int y = y0; y < y1; y++) {
+    float t = (y + 0.5f - quad.y) / quad.h * image.height - 0.5f;
+    t = std::min(std::max(t, 0.0f), image.height - 1.0f);
+    int ty = (int)t, ty1 = std::min(ty + 1, image.height - 1);
+    uint32_t fy = (uint32_t)((t - ty) * 256);
+    const uint8_t *row0 = &image.pixels[ty * image.width * 4];
+    const uint8_t *row1 = &image.pixels[ty1 * image.width * 4];
+    uint32_t *dst = tile.pixels + y * tile.stride;
+
+    for (int x = x0; x < x1; x++) {
+      float s = (x + 0.5f - quad.x) / quad.w * image.width - 0.5f;
+      s = std::min(std::max(s, 0.0f), image.width - 1.0f);
+      int sx = (int)s, sx1 = std::min(sx + 1, image.width - 1);
+      uint32_t fx = (uint32_t)((s - sx) * 256);
+
+      uint8_t texel[4];
+      for (int i = 0; i < 4; i++) {
+        uint32_t top = row0[sx * 4 + i] * (256 - fx) + row0[sx1 * 4 + i] * fx;
+        uint32_t bottom =
+            row1[sx * 4 + i] * (256 - fx) + row1[sx1 * 4 + i] * fx;
+        texel[i] = (uint8_t)((top * (256 - fy) + bottom * fy + 32768) >> 16);
+      }
+      uint32_t alpha = texel[3];
+      if (alpha == 0)
+        continue;
+      uint16_t src[4] = {(uint16_t)(texel[0] * alpha),
+                         (uint16_t)(texel[1] * alpha),
+                         (uint16_t)(texel[2] * alpha), (uint16_t)(255 * alpha)};
+      BlendPixel(dst + x, src, 255 - alpha);
+    }
+  }
+}
+
+// Signed distance to drawHeart's outline folded onto its right half. The
+// closing edge along the axis counts for inside/outside but not for
+// distance, since it is not part of the outline.
+float HeartDistance(float x, float y) {
+  const float *v = HeartOutline();
+  x = std::fabs(x);
+  float best = 1e30f;
+  bool inside = false;
+  for (int i = 0; i < kHeartOutlinePoints; i++) {
+    int j = i == 0 ? kHeartOutlinePoints - 1 : i - 1;
+    float ax = v[i * 2], ay = v[i * 2 + 1];
+    float ex = v[j * 2] - ax, ey = v[j * 2 + 1] - ay;
+    float wx = x - ax, wy = y - ay;
+    if ((ay <= y) != (v[j * 2 + 1] <= y) &&
+        x < ax + ex * (y - ay) / ey)
+      inside = !inside;
+    if (i == 0)
+      continue; // the axis
+    float t = std::min(std::max((wx * ex + wy * ey) / (ex * ex + ey * ey),
+                                0.0f),
+                       1.0f);
+    float bx = wx - ex * t, by = wy - ey * t;
+    best = std::min(best, bx * bx + by * by);
+  }
+  float d = std::sqrt(best);
+  return inside ? -d : d;
+}
+
+// Signed distance in shape units, negative inside; gl_renderer.cpp
+// evaluates the same in its fragment shader
+float ShapeDistance(Shape shape, float x, float y) {
+  switch (shape) {
+  case SHAPE_CIRCLE:
+    return std::sqrt(x * x + y * y) - 1.0f;
+  case SHAPE_BOWL:
+    return std::max(std::sqrt(x * x + y * y) - 1.0f, y);
+  case SHAPE_HEART:
+    return HeartDistance(x, y);
+  }
+  return 1.0f;
+}
+
+void BlendCoverage(uint32_t *dst, const ShapeQuad &shape, float coverage) {
+  uint32_t alpha = (uint32_t)(shape.alpha * coverage + 0.5f);
+  if (alpha == 0)
+    return;
+  uint16_t src[4] = {(uint16_t)(shape.rgb[0] * alpha),
+                     (uint16_t)(shape.rgb[1] * alpha),
+                     (uint16_t)(shape.rgb[2] * alpha), (uint16_t)(255 * alpha)};
+  BlendPixel(dst, src, 255 - alpha);
+}
+
+// Coverage ramps over one pixel across the edge. Circle and bowl rows fill
+// their solid middle as a span and only evaluate the distance at the rim.
+void RasterShape(const Command &cmd, const Tile &tile) {
+  const ShapeQuad &shape = cmd.shape;
+  int x0 = std::max(cmd.x0, tile.x0), x1 = std::min(cmd.x1, tile.x1);
+  int y0 = std::max(cmd.y0, tile.y0), y1 = std::min(cmd.y1, tile.y1);
+  float halfPixel = 0.5f * shape.pixel;
+  float inner = 1.0f - halfPixel, outer = 1.0f + halfPixel;
+
+  for (int y = y0; y < y1; y++) {
+    float sy = (y + 0.5f - shape.cy) * shape.unitsY;
+    uint32_t *row = tile.pixels + y * tile.stride;
+    int from = x0, to = x1 - 1;
+    int solidFrom = to + 1, solidTo = to;
+
+    if (shape.shape != SHAPE_HEART) {
+      if (sy * sy >= outer * outer ||
+          (shape.shape == SHAPE_BOWL && sy >= halfPixel))
+        continue;
+      float reach = std::sqrt(outer * outer - sy * sy) / shape.unitsX;
+      from = std::max(from, Floor(shape.cx - reach - 0.5f));
+      to = std::min(to, Ceil(shape.cx + reach - 0.5f));
+      bool solidRow = sy * sy < inner * inner &&
+                      (shape.shape == SHAPE_CIRCLE || sy <= -halfPixel);
+      if (solidRow && shape.alpha == 255) {
+        float half = std::sqrt(inner * inner - sy * sy) / shape.unitsX;
+        solidFrom = std::max(from, Ceil(shape.cx - half - 0.5f));
+        solidTo = std::min(to, Floor(shape.cx + half - 0.5f));
+        if (solidFrom <= solidTo) {
+          uint32_t packed;
+          uint8_t rgba[4] = {shape.rgb[0], shape.rgb[1], shape.rgb[2], 255};
+          memcpy(&packed, rgba, 4);
+          std::fill(row + solidFrom, row + solidTo + 1, packed);
+        }
+      }
+    }
+
+    for (int x = from; x <= to; x++) {
+      if (x == solidFrom && solidFrom <= solidTo) {
+        x = solidTo;
+        continue;
+      }
+      float sx = (x + 0.5f - shape.cx) * shape.unitsX;
+      float d = ShapeDistance(shape.shape, sx, sy);
+      float coverage = 0.5f - d / shape.pixel;
+      if (coverage > 0)
+        BlendCoverage(row + x, shape, std::min(coverage, 1.0f));
+    }
+  }
+}
+
+void RasterGlyph(const Command &cmd, const Tile &tile) {
+  const GlyphBitmap &glyph = cmd.glyph;
+  int stride = (glyph.width + 7) / 8;
+  int x0 = std::max(cmd.x0, tile.x0), x1 = std::min(cmd.x1, tile.x1);
+  int y0 = std::max(cmd.y0, tile.y0), y1 = std::min(cmd.y1, tile.y1);
+
+  for (int y = y0; y < y1; y++) {
+    const unsigned char *bits = glyph.rows + (y - glyph.y) * stride;
+    uint32_t *dst = tile.pixels + y * tile.stride;
+    for (int x = x0; x < x1; x++) {
+      int i = x - glyph.x;
+      if (bits[i >> 3] & (0x80 >> (i & 7)))
+        dst[x] = cmd.paint.packed;
+    }
+  }
+}
+
+// =============================================================================
+// Backend
+// =============================================================================
+
+struct Projection {
+  float left, right, bottom, top;
+};
+
+class SoftwareRenderer : public RenderBackend {
+public:
+  SoftwareRenderer(int width, int height)
+      : width(width), height(height), pixels(width * height) {
+    tilesX = (width + kTileSize - 1) / kTileSize;
+    tilesY = (height + kTileSize - 1) / kTileSize;
+    // Room for a busy frame up front, so the bins are not still growing
+    // one at a time long after the scene has settled
+    bins.resize(tilesX * tilesY);
+    for (std::vector<int> &bin : bins)
+      bin.reserve(kBinReserve);
+    projections.push_back({0, (float)width, 0, (float)height});
+  }
+
+  const char *Name() const override { return "software"; }
+
+  void BeginFrame(float r, float g, float b) override {
+    clear = MakePaint(r, g, b, 1.0f);
+    commands.clear();
+    polygonEdges.clear();
+    for (std::vector<int> &bin : bins)
+      bin.clear();
+  }
+
+  void EndFrame() override {
+    ParallelFor(tilesX * tilesY, 1, [this](int begin, int end) {
+      for (int i = begin; i < end; i++)
+        RasterTile(i);
+    });
+  }
+
+  void PushProjection(float left, float right, float bottom,
+                      float top) override {
+    projections.push_back({left, right, bottom, top});
+  }
+
+  void PopProjection() override {
+    if (projections.size() > 1)
+      projections.pop_back();
+  }
+
+  void FillPrimitive(Primitive primitive, const float *xy, int count, float r,
+                     float g, float b, float a) override {
+    Paint paint = MakePaint(r, g, b, a);
+    auto vertex = [xy](int i) { return xy + i * 2; };
+
+    switch (primitive) {
+    case PRIM_TRIANGLES:
+      for (int i = 0; i + 2 < count; i += 3)
+        AddTriangle(vertex(i), vertex(i + 1), vertex(i + 2), paint);
+      break;
+    case PRIM_TRIANGLE_FAN:
+      if (AddFanPolygon(xy, count, paint))
+        break;
+      for (int i = 1; i + 1 < count; i++)
+        AddTriangle(vertex(0), vertex(i), vertex(i + 1), paint);
+      break;
+    case PRIM_QUADS:
+      for (int i = 0; i + 3 < count; i += 4) {
+        if (AddPolygon(vertex(i), 4, paint))
+          continue;
+        AddTriangle(vertex(i), vertex(i + 1), vertex(i + 2), paint);
+        AddTriangle(vertex(i), vertex(i + 2), vertex(i + 3), paint);
+      }
+      break;
+    }
+  }
+
+  bool FillShape(Shape shape, float x, float y, float size, float r, float g,
+                 float b, float a) override {
+    const Projection &p = projections.back();
+    float pixelsX = size * width / (p.right - p.left);
+    float pixelsY = size * height / (p.top - p.bottom);
+    if (!(pixelsX > 0 && pixelsY > 0))
+      return true; // nothing to draw
+
+    Command cmd;
+    cmd.type = Command::SHAPE;
+    ShapeQuad &quad = cmd.shape;
+    quad.shape = shape;
+    Project(x, y, quad.cx, quad.cy);
+    quad.unitsX = 1.0f / pixelsX;
+    quad.unitsY = 1.0f / pixelsY;
+    quad.pixel = std::sqrt(0.5f * (quad.unitsX * quad.unitsX +
+                                   quad.unitsY * quad.unitsY));
+    Paint paint = MakePaint(r, g, b, a);
+    memcpy(quad.rgb, &paint.packed, 3);
+    quad.alpha = 255 - paint.inv;
+
+    // Shape-unit bounds, grown by a pixel for the antialiased rim
+    float left = -1, right = 1, bottom = -1, top = 1;
+    if (shape == SHAPE_BOWL)
+      top = 0;
+    else if (shape == SHAPE_HEART) {
+      left = -16;
+      right = 16;
+      bottom = -12;
+      top = 17;
+    }
+    cmd.x0 = Floor(std::max(quad.cx + left * pixelsX - 1, -1.0f));
+    cmd.x1 = Ceil(std::min(quad.cx + right * pixelsX + 1, width + 1.0f));
+    cmd.y0 = Floor(std::max(quad.cy + bottom * pixelsY - 1, -1.0f));
+    cmd.y1 = Ceil(std::min(quad.cy + top * pixelsY + 1, height + 1.0f));
+    Record(cmd);
+    return true;
+  }
+
+  GLuint CreateTexture(const Image &image) override {
+    textures.push_back(&image);
+    return (GLuint)textures.size(); // 0 stays "no texture"
+  }
+
+  void DrawTexture(GLuint texture, float x, float y, float w,
+                   float h) override {
+    if (texture == 0 || texture > textures.size())
+      return;
+    float x0, y0, x1, y1;
+    Project(x, y, x0, y0);
+    Project(x + w, y + h, x1, y1);
+
+    Command cmd;
+    cmd.type = Command::TEXTURE;
+    cmd.texture = {textures[texture - 1], x0, y0, x1 - x0, y1 - y0};
+    cmd.x0 = (int)std::ceil(std::min(x0, x1) - 0.5f);
+    cmd.x1 = (int)std::ceil(std::max(x0, x1) - 0.5f);
+    cmd.y0 = (int)std::ceil(std::min(y0, y1) - 0.5f);
+    cmd.y1 = (int)std::ceil(std::max(y0, y1) - 0.5f);
+    Record(cmd);
+  }
+
+  void DrawText(const char *text, int length, float x, float y, void *font,
+                float r, float g, float b) override {
+    // Like glRasterPos, a start point outside the window draws nothing
+    float rx, ry;
+    Project(x, y, rx, ry);
+    if (rx < 0 || rx > width || ry < 0 || ry > height)
+      return;
+
+    const BitmapFont &bitmapFont = GetBitmapFont(font);
+    Command cmd;
+    cmd.type = Command::GLYPH;
+    cmd.paint = MakePaint(r, g, b, 1.0f);
+    for (int i = 0; i < length; i++) {
+      unsigned char c = text[i];
+      int advance = bitmapFont.Advance(c);
+      cmd.glyph.rows = bitmapFont.Rows(c);
+      cmd.glyph.width = advance;
+      cmd.glyph.height = bitmapFont.height;
+      cmd.glyph.x = (int)std::floor(rx - bitmapFont.xorig);
+      cmd.glyph.y = (int)std::floor(ry - bitmapFont.yorig);
+      cmd.x0 = cmd.glyph.x;
+      cmd.y0 = cmd.glyph.y;
+      cmd.x1 = cmd.glyph.x + advance;
+      cmd.y1 = cmd.glyph.y + bitmapFont.height;
+      Record(cmd);
+      rx += advance;
+    }
+  }
+
+  void ReadFrame(std::vector<unsigned char> &rgba) override {
+    rgba.resize(pixels.size() * 4);
+    memcpy(rgba.data(), pixels.data(), rgba.size());
+  }
+
+  // The frame is complete after EndFrame, so a plain copy is all it takes
+  void QueueReadback() override {
+    ReadFrame(readback);
+    readbackQueued = true;
+  }
+
+  // Never waits: QueueReadback already copied the frame
+  bool TakeReadback(std::vector<unsigned char> &rgba,
+                    bool /*wait*/) override {
+    if (!readbackQueued)
+      return false;
+    rgba.swap(readback); // the caller's buffer is reused for the next copy
+    readbackQueued = false;
+    return true;
+  }
+
+private:
+  void Project(float x, float y, float &wx, float &wy) const {
+    const Projection &p = projections.back();
+    wx = (x - p.left) * width / (p.right - p.left);
+    wy = (y - p.bottom) * height / (p.top - p.bottom);
+  }
+
+  void AddTriangle(const float *a, const float *b, const float *c,
+                   const Paint &paint) {
+    float v[6];
+    Project(a[0], a[1], v[0], v[1]);
+    Project(b[0], b[1], v[2], v[3]);
+    Project(c[0], c[1], v[4], v[5]);
+
+    float area = (v[2] - v[0]) * (v[5] - v[1]) - (v[4] - v[0]) * (v[3] - v[1]);
+    if (area == 0)
+      return;
+    if (area < 0) {
+      std::swap(v[2], v[4]);
+      std::swap(v[3], v[5]);
+    }
+
+    Command cmd;
+    cmd.type = Command::TRIANGLE;
+    cmd.paint = paint;
+    cmd.edges[0] = MakeEdge(v[0], v[1], v[2], v[3]);
+    cmd.edges[1] = MakeEdge(v[2], v[3], v[4], v[5]);
+    cmd.edges[2] = MakeEdge(v[4], v[5], v[0], v[1]);
+
+    float minX = std::min(std::min(v[0], v[2]), v[4]);
+    float maxX = std::max(std::max(v[0], v[2]), v[4]);
+    float minY = std::min(std::min(v[1], v[3]), v[5]);
+    float maxY = std::max(std::max(v[1], v[3]), v[5]);
+    cmd.x0 = (int)std::floor(std::max(minX, -1.0f));
+    cmd.x1 = (int)std::ceil(std::min(maxX, width + 1.0f));
+    cmd.y0 = (int)std::floor(std::max(minY, -1.0f));
+    cmd.y1 = (int)std::ceil(std::min(maxY, height + 1.0f));
+    Record(cmd);
+  }
+
+  // A fan around a center inside a closed ring (drawCircle) covers the ring
+  // polygon; an open fan (drawBowl) covers the polygon starting at its center
+  bool AddFanPolygon(const float *xy, int count, const Paint &paint) {
+    if (count < 3)
+      return false;
+    const float *first = xy + 2, *last = xy + (count - 1) * 2;
+    if (count > 4 && first[0] == last[0] && first[1] == last[1]) {
+      // The center must be inside for the ring alone to match the fan
+      int n = count - 2;
+      bool positive = false, negative = false;
+      for (int i = 0; i < n; i++) {
+        const float *a = first + i * 2, *b = first + ((i + 1) % n) * 2;
+        float cross =
+            (b[0] - a[0]) * (xy[1] - a[1]) - (b[1] - a[1]) * (xy[0] - a[0]);
+        positive |= cross > 0;
+        negative |= cross < 0;
+      }
+      if (positive && negative)
+        return false;
+      return AddPolygon(first, n, paint);
+    }
+    return AddPolygon(xy, count, paint);
+  }
+
+  // Returns false, drawing nothing, if the polygon is not convex
+  bool AddPolygon(const float *xy, int count, const Paint &paint) {
+    const int kMaxPolygon = 512;
+    if (count < 3 || count > kMaxPolygon)
+      return false;
+
+    // Window coordinates without repeated points, counter-clockwise
+    float v[kMaxPolygon * 2];
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+      Project(xy[i * 2], xy[i * 2 + 1], v[n * 2], v[n * 2 + 1]);
+      if (n == 0 || v[n * 2] != v[n * 2 - 2] || v[n * 2 + 1] != v[n * 2 - 1])
+        n++;
+    }
+    if (n > 1 && v[0] == v[n * 2 - 2] && v[1] == v[n * 2 - 1])
+      n--;
+    if (n < 3)
+      return true; // degenerate: nothing to draw
+
+    float area = 0;
+    for (int i = 0; i < n; i++) {
+      int j = (i + 1) % n;
+      area += v[i * 2] * v[j * 2 + 1] - v[j * 2] * v[i * 2 + 1];
+    }
+    if (area == 0)
+      return true;
+    if (area < 0)
+      for (int i = 0; i < n / 2; i++) {
+        std::swap(v[i * 2], v[(n - 1 - i) * 2]);
+        std::swap(v[i * 2 + 1], v[(n - 1 - i) * 2 + 1]);
+      }
+    if (!IsConvex(v, n))
+      return false;
+
+    Command cmd;
+    cmd.type = Command::POLYGON;
+    cmd.paint = paint;
+    cmd.polygon.first = (int)polygonEdges.size();
+    float minX = v[0], maxX = v[0], minY = v[1], maxY = v[1];
+    for (int side = 1; side >= -1; side -= 2) {
+      size_t chainStart = polygonEdges.size();
+      for (int i = 0; i < n; i++) {
+        const float *p = v + i * 2, *q = v + ((i + 1) % n) * 2;
+        Edge edge = MakeEdge(p[0], p[1], q[0], q[1]);
+        if (edge.side != side)
+          continue;
+        polygonEdges.push_back(
+            {edge, std::min(p[1], q[1]), std::max(p[1], q[1])});
+      }
+      std::sort(polygonEdges.begin() + chainStart, polygonEdges.end(),
+                [](const PolygonEdge &a, const PolygonEdge &b) {
+                  return a.ymin < b.ymin;
+                });
+      int chainLength = (int)(polygonEdges.size() - chainStart);
+      if (side > 0)
+        cmd.polygon.leftCount = chainLength;
+      else
+        cmd.polygon.rightCount = chainLength;
+    }
+    for (int i = 1; i < n; i++) {
+      minX = std::min(minX, v[i * 2]);
+      maxX = std::max(maxX, v[i * 2]);
+      minY = std::min(minY, v[i * 2 + 1]);
+      maxY = std::max(maxY, v[i * 2 + 1]);
+    }
+    if (cmd.polygon.leftCount == 0 || cmd.polygon.rightCount == 0)
+      return true;
+
+    // Only rows whose centers fall inside the polygon's y range
+    cmd.x0 = Floor(std::max(minX, -1.0f));
+    cmd.x1 = Ceil(std::min(maxX, width + 1.0f));
+    cmd.y0 = Ceil(std::max(minY, -1.0f) - 0.5f);
+    cmd.y1 = Ceil(std::min(maxY, height + 1.0f) - 0.5f);
+    Record(cmd);
+    return true;
+  }
+
+  // Clips the command's bounds to the framebuffer and bins it into tiles
+  void Record(Command &cmd) {
+    cmd.x0 = std::max(cmd.x0, 0);
+    cmd.y0 = std::max(cmd.y0, 0);
+    cmd.x1 = std::min(cmd.x1, width);
+    cmd.y1 = std::min(cmd.y1, height);
+    if (cmd.x0 >= cmd.x1 || cmd.y0 >= cmd.y1)
+      return;
+
+    int index = (int)commands.size();
+    commands.push_back(cmd);
+    for (int ty = cmd.y0 / kTileSize; ty <= (cmd.y1 - 1) / kTileSize; ty++)
+      for (int tx = cmd.x0 / kTileSize; tx <= (cmd.x1 - 1) / kTileSize; tx++)
+        bins[ty * tilesX + tx].push_back(index);
+  }
+
+  void RasterTile(int index) {
+    Tile tile;
+    tile.x0 = (index % tilesX) * kTileSize;
+    tile.y0 = (index / tilesX) * kTileSize;
+    tile.x1 = std::min(tile.x0 + kTileSize, width);
+    tile.y1 = std::min(tile.y0 + kTileSize, height);
+    tile.pixels = pixels.data();
+    tile.stride = width;
+
+    for (int y = tile.y0; y < tile.y1; y++)
+      FillSpan(tile.pixels + y * width + tile.x0, tile.x1 - tile.x0, clear);
+
+    for (int i : bins[index]) {
+      const Command &cmd = commands[i];
+      switch (cmd.type) {
+      case Command::TRIANGLE:
+        RasterTriangle(cmd, tile);
+        break;
+      case Command::POLYGON:
+        RasterPolygon(cmd, tile, polygonEdges.data());
+        break;
+      case Command::TEXTURE:
+        RasterTexture(cmd, tile);
+        break;
+      case Command::GLYPH:
+        RasterGlyph(cmd, tile);
+        break;
+      case Command::SHAPE:
+        RasterShape(cmd, tile);
+        break;
+      }
+    }
+  }
+
+  int width, height;
+  int tilesX, tilesY;
+  std::vector<uint32_t> pixels; // RGBA bytes, bottom row first
+  Paint clear;
+
+  std::vector<Projection> projections;
+  std::vector<const Image *> textures;
+
+  // Rebuilt every frame; capacity is kept so steady-state frames don't
+  // allocate
+  std::vector<Command> commands;
+  std::vector<PolygonEdge> polygonEdges;
+  std::vector<std::vector<int>> bins;
+
+  std::vector<unsigned char> readback;
+  bool readbackQueued = false;
+};
+
+} // namespace
+
+RenderBackend *CreateSoftwareRenderer(int width, int height) {
+  return new SoftwareRenderer(width, height);
+}
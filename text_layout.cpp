@@ -0,0 +1,150 @@
+#include "text_layout.h"
+
+#include "bitmap_font.h"
+#include "render_backend.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// A line of text starting at (x, y): text[start, start + length)
+struct GlyphRun {
+  float x, y;
+  int start, length;
+};
+
+struct TextLayout {
+  std::string text;
+  void *font;
+  TextBox box;
+  std::vector<GlyphRun> runs;
+  float height;
+};
+
+// Layouts are only ever added for distinct strings, so this stays small;
+// the cap guards against callers feeding it per-frame dynamic text
+const size_t kMaxCachedLayouts = 512;
+
+std::unordered_map<uint64_t, std::vector<TextLayout>> layouts;
+size_t layoutCount = 0;
+
+// FNV-1a over the text, font handle and box
+uint64_t HashKey(const char *text, void *font, const TextBox &box) {
+  uint64_t hash = 14695981039346656037ull;
+  auto mix = [&hash](const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+  };
+  mix(text, strlen(text));
+  mix(&font, sizeof(font));
+  mix(&box, sizeof(box));
+  return hash;
+}
+
+bool SameBox(const TextBox &a, const TextBox &b) {
+  return a.x == b.x && a.y == b.y && a.width == b.width &&
+         a.lineHeight == b.lineHeight && a.align == b.align;
+}
+
+void PlaceLine(TextLayout &layout, int start, int end, float width,
+               float y) {
+  const TextBox &box = layout.box;
+  float x = box.x;
+  if (box.align == ALIGN_CENTER)
+    x += (box.width - width) / 2;
+  else if (box.align == ALIGN_RIGHT)
+    x += box.width - width;
+  layout.runs.push_back({x, y, start, end - start});
+}
+
+// Greedy word wrap: break before the word that would overflow the box
+void Layout(TextLayout &layout) {
+  const BitmapFont &metrics = GetBitmapFont(layout.font);
+  const char *text = layout.text.c_str();
+  int length = (int)layout.text.size();
+  float y = layout.box.y;
+
+  int lineStart = 0;
+  float lineWidth = 0;
+  int i = 0;
+  while (i <= length) {
+    if (i == length || text[i] == '\n') {
+      PlaceLine(layout, lineStart, i, lineWidth, y);
+      y -= layout.box.lineHeight;
+      lineStart = i + 1;
+      lineWidth = 0;
+      i++;
+      continue;
+    }
+
+    // Measure the next word along with the spaces in front of it
+    int wordEnd = i;
+    float wordWidth = 0;
+    while (wordEnd < length && text[wordEnd] == ' ')
+      wordWidth += metrics.Advance(text[wordEnd++]);
+    int spaceEnd = wordEnd;
+    float spaceWidth = wordWidth;
+    while (wordEnd < length && text[wordEnd] != ' ' && text[wordEnd] != '\n')
+      wordWidth += metrics.Advance(text[wordEnd++]);
+
+    if (lineWidth > 0 && lineWidth + wordWidth > layout.box.width) {
+      PlaceLine(layout, lineStart, i, lineWidth, y);
+      y -= layout.box.lineHeight;
+      lineStart = spaceEnd; // drop the spaces at the break
+      lineWidth = wordWidth - spaceWidth;
+    } else {
+      lineWidth += wordWidth;
+    }
+    i = wordEnd;
+  }
+  layout.height = layout.runs.size() * layout.box.lineHeight;
+}
+
+const TextLayout &FindLayout(const char *text, void *font,
+                             const TextBox &box) {
+  uint64_t key = HashKey(text, font, box);
+  std::vector<TextLayout> &bucket = layouts[key];
+  for (const TextLayout &layout : bucket)
+    if (layout.font == font && SameBox(layout.box, box) &&
+        layout.text == text)
+      return layout;
+
+  if (layoutCount >= kMaxCachedLayouts) {
+    layouts.clear();
+    layoutCount = 0;
+    return FindLayout(text, font, box);
+  }
+
+  bucket.emplace_back();
+  TextLayout &layout = bucket.back();
+  layout.text = text;
+  layout.font = font;
+  layout.box = box;
+  Layout(layout);
+  layoutCount++;
+  return layout;
+}
+
+} // namespace
+
+float glyphAdvance(void *font, unsigned char c) {
+  return GetBitmapFont(font).Advance(c);
+}
+
+float drawTextBox(const char *text, const TextBox &box, void *font, float r,
+                  float g, float b) {
+  const TextLayout &layout = FindLayout(text, font, box);
+  const char *chars = layout.text.c_str();
+
+  for (const GlyphRun &run : layout.runs)
+    Renderer()->DrawText(chars + run.start, run.length, run.x, run.y, font, r,
+                         g, b);
+  return layout.height;
+}
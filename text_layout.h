@@ -0,0 +1,27 @@
+// Word wrap and alignment for bitmap text. A string is laid out once per
+// distinct (text, font, box) using the font's real glyph advances; the
+// positioned runs are cached and replayed every frame without allocating.
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <GL/glut.h>
+
+enum TextAlign { ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT };
+
+struct TextBox {
+  float x, y;       // left edge and baseline of the first line
+  float width;      // lines wrap at spaces to stay within this width
+  float lineHeight; // baseline-to-baseline distance
+  TextAlign align;
+};
+
+// Advance of one glyph in pixels, from the embedded font metrics
+float glyphAdvance(void *font, unsigned char c);
+
+// Draws text wrapped and aligned inside the box; returns the height used
+// (lines * lineHeight) so callers can stack paragraphs
+float drawTextBox(const char *text, const TextBox &box,
+                  void *font = GLUT_BITMAP_HELVETICA_18, float r = 0.0f,
+                  float g = 0.0f, float b = 0.0f);
+
+#endif
@@ -0,0 +1,123 @@
+// Keyframe timeline for cutscenes. A cutscene is a set of tracks, each a
+// sorted list of (time, value) keys; the scene state at any time t is found
+// by binary search, so scenes advance one clock instead of chaining timers.
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+enum Interpolation { STEP, LINEAR };
+
+struct Vec2 {
+  float x, y;
+};
+
+// Values that cannot be blended (text, flags) just hold until the next key
+template <typename T> T Lerp(const T &a, const T &b, float u) {
+  return u < 1.0f ? a : b;
+}
+inline float Lerp(const float &a, const float &b, float u) {
+  return a + (b - a) * u;
+}
+inline Vec2 Lerp(const Vec2 &a, const Vec2 &b, float u) {
+  return {a.x + (b.x - a.x) * u, a.y + (b.y - a.y) * u};
+}
+
+template <typename T> class Track {
+public:
+  explicit Track(Interpolation interp = LINEAR) : interp(interp) {}
+
+  // Keys may be added in any order; they are kept sorted by time
+  void Key(float time, const T &value) {
+    auto it = std::upper_bound(
+        keys.begin(), keys.end(), time,
+        [](float t, const Keyframe &key) { return t < key.time; });
+    keys.insert(it, Keyframe{time, value});
+  }
+
+  // Times past loopEnd wrap back into [loopStart, loopEnd)
+  void Loop(float start, float end) {
+    loopStart = start;
+    loopEnd = end;
+  }
+
+  // An empty track has nothing to say and gives T()
+  T Evaluate(float t) const {
+    if (keys.empty())
+      return T();
+    if (loopEnd > loopStart && t >= loopEnd)
+      t = loopStart + std::fmod(t - loopStart, loopEnd - loopStart);
+
+    // First key strictly after t; the key before it is the active one
+    auto next = std::upper_bound(
+        keys.begin(), keys.end(), t,
+        [](float t, const Keyframe &key) { return t < key.time; });
+    if (next == keys.begin())
+      return keys.front().value;
+    if (next == keys.end())
+      return keys.back().value;
+
+    const Keyframe &prev = *(next - 1);
+    if (interp == STEP)
+      return prev.value;
+    float u = (t - prev.time) / (next->time - prev.time);
+    return Lerp(prev.value, next->value, u);
+  }
+
+  float EndTime() const { return keys.empty() ? 0.0f : keys.back().time; }
+
+private:
+  struct Keyframe {
+    float time;
+    T value;
+  };
+
+  Interpolation interp;
+  std::vector<Keyframe> keys;
+  float loopStart = 0, loopEnd = 0;
+};
+
+// Seconds needed to move between two positions at the given speed
+inline float TravelTime(float from, float to, float speedPerSecond) {
+  return std::fabs(to - from) / speedPerSecond;
+}
+
+// The clock a cutscene's tracks are evaluated against. Since every track is
+// a pure function of time, jumping to any point is just setting the clock.
+class Timeline {
+public:
+  void SetDuration(float seconds) { duration = seconds; }
+  float Duration() const { return duration; }
+
+  void Advance(float dt) { time += dt; }
+  void Seek(float t) { time = t; }
+  float Time() const { return time; }
+  bool Finished() const { return time >= duration; }
+
+  // Named story beats, e.g. "just_right", that QA can jump straight to
+  void Mark(const char *name, float t) { markers.push_back({name, t}); }
+  bool FindMarker(const char *name, float &t) const {
+    for (const Marker &marker : markers) {
+      if (strcmp(marker.name, name) == 0) {
+        t = marker.time;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  struct Marker {
+    const char *name;
+    float time;
+  };
+
+  float time = 0;
+  float duration = 0;
+  std::vector<Marker> markers;
+};
+
+#endif
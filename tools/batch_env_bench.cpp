@@ -0,0 +1,146 @@
+// Batch environment benchmark: steps 64k Season Catcher games with random
+// actions and reports environment steps per second from 1 worker up to one
+// per hardware core, with and without writing observations, how many 84x56
+// observation grids per second it draws, and how many games per second the
+// catcher bot plans.
+//
+//   g++ -std=c++17 -O2 -I. tools/batch_env_bench.cpp batch_env.cpp
+//       observation_grid.cpp catcher_bot.cpp random.cpp engine.cpp
+//       bitmap_font.cpp job_system.cpp -o batch_env_bench -lglut -lGL
+//       -pthread
+//   ./batch_env_bench [steps] [max_workers] [games]
+#include "batch_env.h"
+#include "catcher_bot.h"
+#include "job_system.h"
+#include "observation_grid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Action sets cycled through, so drawing actions stays out of the timing
+const int kActionSets = 16;
+// Games and ticks the bot plays to measure how far it gets
+const int kBotGames = 1024;
+const int kBotTicks = 10000;
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+struct Buffers {
+  std::vector<int8_t> actions, botActions;
+  std::vector<float> observations, reward;
+  std::vector<uint8_t> done, grids;
+};
+
+// Environment steps per second over steps batched steps
+double StepRate(BatchEnv &env, Buffers &b, int steps, bool observe,
+                long long &episodes) {
+  int games = env.Count();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < steps; i++) {
+    env.Step(b.actions.data() + (size_t)(i % kActionSets) * games,
+             observe ? b.observations.data() : nullptr, b.reward.data(),
+             b.done.data());
+    for (int g = 0; g < games; g += 997) // sample, to keep it cheap
+      episodes += b.done[g];
+  }
+  return (double)games * steps / Seconds(start);
+}
+
+// Observation grids drawn per second, stepping the games untimed in between
+double GridRate(BatchEnv &env, const ObservationGrid &grid, Buffers &b,
+                int steps) {
+  double total = 0;
+  for (int i = 0; i < steps; i++) {
+    env.Step(b.actions.data() + (size_t)(i % kActionSets) * env.Count(),
+             nullptr, b.reward.data(), b.done.data());
+    auto start = std::chrono::steady_clock::now();
+    grid.DrawAll(env, b.grids.data());
+    total += Seconds(start);
+  }
+  return (double)env.Count() * steps / total;
+}
+
+// Games the bot plans per second, stepping them on its moves untimed
+double BotRate(BatchEnv &env, Buffers &b, int steps) {
+  double total = 0;
+  for (int i = 0; i < steps; i++) {
+    auto start = std::chrono::steady_clock::now();
+    PlanBatchMoves(env, b.botActions.data());
+    total += Seconds(start);
+    env.Step(b.botActions.data(), nullptr, b.reward.data(), b.done.data());
+  }
+  return (double)env.Count() * steps / total;
+}
+
+double MeanLevel(const BatchEnv &env) {
+  double total = 0;
+  for (int i = 0; i < env.Count(); i++)
+    total += env.Level(i);
+  return total / env.Count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int steps = argc > 1 ? std::max(1, atoi(argv[1])) : 500;
+  int maxWorkers = std::max(1, (int)std::thread::hardware_concurrency());
+  if (argc > 2)
+    maxWorkers = std::max(1, atoi(argv[2]));
+  int games = argc > 3 ? std::max(1, atoi(argv[3])) : 65536;
+
+  BatchEnv env(games);
+  Buffers b;
+  b.actions.resize((size_t)kActionSets * games);
+  b.botActions.resize(std::max(games, kBotGames));
+  b.observations.resize((size_t)games * BatchEnv::kObservationSize);
+  b.reward.resize(std::max(games, kBotGames));
+  b.done.resize(std::max(games, kBotGames));
+  ObservationGrid grid;
+  b.grids.resize(grid.Size() * games);
+  Random random(1);
+  for (int8_t &action : b.actions)
+    action = (int8_t)(random.Below(3) - 1);
+
+  double baseline = 0;
+  long long episodes = 0;
+  printf("%8s %14s %14s %14s %14s %9s\n", "workers", "steps/s",
+         "+obs steps/s", "grids/s", "bot plans/s", "speedup");
+  for (int workers = 1; workers <= maxWorkers; workers++) {
+    if (workers > 1)
+      StartJobSystem(workers - 1);
+
+    StepRate(env, b, 10, false, episodes); // warm up
+    double rate = StepRate(env, b, steps, false, episodes);
+    double observed = StepRate(env, b, steps, true, episodes);
+    double grids = GridRate(env, grid, b, std::max(1, steps / 10));
+    double plans = BotRate(env, b, std::max(1, steps / 10));
+    if (workers == 1)
+      baseline = rate;
+
+    printf("%8d %13.1fM %13.1fM %13.1fM %13.1fM %8.2fx\n", workers,
+           rate / 1e6, observed / 1e6, grids / 1e6, plans / 1e6,
+           rate / baseline);
+    StopJobSystem();
+  }
+  printf("%d games, %lld sampled episodes ended\n", games, episodes);
+
+  // How well the bot plays, over a smaller batch from a fresh start
+  BatchEnv botEnv(kBotGames);
+  for (int i = 0; i < kBotTicks; i++) {
+    PlanBatchMoves(botEnv, b.botActions.data());
+    botEnv.Step(b.botActions.data(), nullptr, b.reward.data(), b.done.data());
+  }
+  printf("Bot reaches level %.2f on average in %d ticks\n",
+         MeanLevel(botEnv), kBotTicks);
+  return 0;
+}
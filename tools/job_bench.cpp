@@ -0,0 +1,83 @@
+// Job system microbenchmark: raw task throughput with empty jobs, and
+// ParallelFor scaling on a compute-bound loop, from 1 worker up to one per
+// hardware core.
+//
+//   g++ -std=c++17 -O2 -I. tools/job_bench.cpp job_system.cpp -o job_bench -pthread
+//   ./job_bench [max_workers]
+#include "job_system.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int kBatch = 1024;
+const int kBatches = 512;
+const int kLoopItems = 1 << 20;
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+// Submits batches of empty jobs and waits on each batch
+double TaskThroughput() {
+  std::vector<Job> jobs(kBatch);
+  for (Job &job : jobs)
+    job = {[](void *, int, int) {}, nullptr, 0, 0, nullptr};
+
+  auto start = std::chrono::steady_clock::now();
+  for (int batch = 0; batch < kBatches; batch++) {
+    JobCounter counter;
+    SubmitJobs(jobs.data(), kBatch, counter);
+    Wait(counter);
+  }
+  return kBatch * (double)kBatches / Seconds(start);
+}
+
+// Seconds for one ParallelFor over a loop heavy enough to split
+double LoopTime(std::vector<float> &out) {
+  auto start = std::chrono::steady_clock::now();
+  ParallelFor(kLoopItems, 4096, [&out](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      float x = i * 0.001f;
+      out[i] = std::sin(x) * std::cos(x * 0.5f) + std::sqrt(x);
+    }
+  });
+  return Seconds(start);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int maxWorkers = std::max(1, (int)std::thread::hardware_concurrency());
+  if (argc > 1)
+    maxWorkers = std::max(1, atoi(argv[1]));
+
+  std::vector<float> out(kLoopItems);
+  double baseline = 0;
+  printf("%8s %16s %12s %9s\n", "workers", "tasks/sec", "loop ms",
+         "speedup");
+  for (int workers = 1; workers <= maxWorkers; workers++) {
+    if (workers > 1)
+      StartJobSystem(workers - 1);
+
+    LoopTime(out); // warm up
+    double loop = 1e30;
+    for (int i = 0; i < 5; i++)
+      loop = std::min(loop, LoopTime(out));
+    double tasks = TaskThroughput();
+    if (workers == 1)
+      baseline = loop;
+
+    printf("%8d %16.0f %12.2f %8.2fx\n", workers, tasks, loop * 1000,
+           baseline / loop);
+    StopJobSystem();
+  }
+  return 0;
+}
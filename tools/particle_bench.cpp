@@ -0,0 +1,72 @@
+// Particle system benchmark: keeps 100k snowflakes alive in a 900x600 window,
+// topping the system back up after every step, and reports update time from
+// 1 worker up to one per hardware core. Drawing is not included.
+//
+//   g++ -std=c++17 -O2 -I. tools/particle_bench.cpp particles.cpp random.cpp
+//       engine.cpp bitmap_font.cpp job_system.cpp -o particle_bench -lglut -lGL
+//       -pthread
+//   ./particle_bench [steps] [max_workers]
+#include "engine.h"
+#include "job_system.h"
+#include "particles.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+const int kParticles = 100000;
+
+// Slow, long-lived flakes anywhere in the window, so most survive a step
+const ParticleEmitter kSnow = {
+    0,   WINDOW_WIDTH, 0,   WINDOW_HEIGHT, -10, 10, 20, 60, 5, 30, 1, 4, 0.05f,
+    1.0f, 1,           1,   1,             0.1f, 0};
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+// Average milliseconds per Update, refilling expired particles untimed
+double StepTime(ParticleSystem &particles, int steps) {
+  double total = 0;
+  for (int i = 0; i < steps; i++) {
+    particles.Spawn(kSnow, kParticles - particles.Count());
+    auto start = std::chrono::steady_clock::now();
+    particles.Update(kTickSeconds, 10, 300);
+    total += Seconds(start);
+  }
+  return total * 1000 / steps;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int steps = argc > 1 ? std::max(1, atoi(argv[1])) : 500;
+  int maxWorkers = std::max(1, (int)std::thread::hardware_concurrency());
+  if (argc > 2)
+    maxWorkers = std::max(1, atoi(argv[2]));
+
+  ParticleSystem particles(kParticles);
+  particles.Seed(Random(1));
+
+  double baseline = 0;
+  printf("%8s %12s %9s\n", "workers", "update ms", "speedup");
+  for (int workers = 1; workers <= maxWorkers; workers++) {
+    if (workers > 1)
+      StartJobSystem(workers - 1);
+
+    StepTime(particles, 10); // warm up
+    double ms = StepTime(particles, steps);
+    if (workers == 1)
+      baseline = ms;
+
+    printf("%8d %12.3f %8.2fx\n", workers, ms, baseline / ms);
+    StopJobSystem();
+  }
+  return 0;
+}
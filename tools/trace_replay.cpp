@@ -0,0 +1,168 @@
+// Draw trace replayer: plays a trace recorded with --trace through a
+// backend as fast as it will go and reports per-frame render times, so
+// backends can be compared on the same real frames. GL renders offscreen
+// and is timed to glFinish; no backend needs a display.
+//
+//   g++ -std=c++17 -O2 -I. tools/trace_replay.cpp trace.cpp background.cpp
+//       engine.cpp palette_mesh.cpp particles.cpp random.cpp gl_renderer.cpp
+//       gl33_renderer.cpp gl_shaders.cpp draw_list.cpp software_renderer.cpp
+//       bitmap_font.cpp job_system.cpp offscreen_gl.cpp capture.cpp
+//       assets.cpp -o trace_replay -lglut -lGLU -lGL -lEGL -lz -pthread
+//   ./trace_replay TRACE [--backend gl|gl-immediate|gl33|software]
+//                  [--sky-shader] [--loops N] [--per-frame]
+//                  [--ppm FRAME PATH]
+//
+// gl-immediate is the legacy GL backend issuing one call per draw in
+// recorded order, against gl's sorted, batched draw list.
+#include "capture.h"
+#include "engine.h"
+#include "job_system.h"
+#include "offscreen_gl.h"
+#include "render_backend.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const int kWarmupFrames = 10;
+
+// What main.cpp's initGL sets up for the game window
+void InitGL() {
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  gluOrtho2D(0, WINDOW_WIDTH, 0, WINDOW_HEIGHT);
+  glMatrixMode(GL_MODELVIEW);
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+double Percentile(std::vector<double> sorted, double fraction) {
+  std::sort(sorted.begin(), sorted.end());
+  size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+int Usage() {
+  printf("usage: trace_replay TRACE [--backend gl|gl-immediate|gl33|software] "
+         "[--sky-shader] [--loops N] [--per-frame] [--ppm FRAME PATH]\n");
+  return 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2)
+    return Usage();
+  const char *path = argv[1];
+  bool software = false, coreProfile = false, immediate = false;
+  bool skyShader = false;
+  bool perFrame = false;
+  int loops = 1;
+  int ppmFrame = -1;
+  const char *ppmPath = nullptr;
+  for (int i = 2; i < argc; i++) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "--backend") == 0 && i + 1 < argc) {
+      const char *backend = argv[++i];
+      if (strcmp(backend, "software") == 0)
+        software = true;
+      else if (strcmp(backend, "gl33") == 0)
+        coreProfile = true;
+      else if (strcmp(backend, "gl-immediate") == 0)
+        immediate = true;
+      else if (strcmp(backend, "gl") != 0) {
+        printf("Unknown backend: %s\n", backend);
+        return 1;
+      }
+    } else if (strcmp(arg, "--sky-shader") == 0)
+      skyShader = true;
+    else if (strcmp(arg, "--loops") == 0 && i + 1 < argc)
+      loops = std::max(1, atoi(argv[++i]));
+    else if (strcmp(arg, "--per-frame") == 0)
+      perFrame = true;
+    else if (strcmp(arg, "--ppm") == 0 && i + 2 < argc) {
+      ppmFrame = atoi(argv[++i]);
+      ppmPath = argv[++i];
+    } else
+      return Usage();
+  }
+
+  TraceReplay trace;
+  if (!trace.Open(path))
+    return 1;
+
+  if (software)
+    SetRenderer(CreateSoftwareRenderer(WINDOW_WIDTH, WINDOW_HEIGHT));
+  else if (coreProfile) {
+    if (!CreateOffscreenContext(WINDOW_WIDTH, WINDOW_HEIGHT, true))
+      return 1;
+    RenderBackend *renderer = CreateGL33Renderer(skyShader);
+    if (!renderer)
+      return 1;
+    SetRenderer(renderer);
+  } else {
+    if (!CreateOffscreenContext(WINDOW_WIDTH, WINDOW_HEIGHT))
+      return 1;
+    InitGL();
+    SetRenderer(CreateGLRenderer(skyShader, immediate));
+  }
+  StartJobSystem();
+
+  // Creates the textures and meshes the first frames use, and warms the
+  // backend's buffers, outside the timing
+  int frames = trace.Frames();
+  for (int i = 0; i < std::min(kWarmupFrames, frames); i++)
+    trace.Replay(i);
+
+  std::vector<double> times(frames, 0.0);
+  auto runStart = std::chrono::steady_clock::now();
+  for (int loop = 0; loop < loops; loop++) {
+    for (int i = 0; i < frames; i++) {
+      auto start = std::chrono::steady_clock::now();
+      trace.Replay(i);
+      if (!software)
+        glFinish();
+      times[i] += std::chrono::duration<double, std::milli>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+
+      if (loop == 0 && i == ppmFrame) {
+        std::vector<unsigned char> rgba;
+        Renderer()->ReadFrame(rgba);
+        if (WritePPM(ppmPath, WINDOW_WIDTH, WINDOW_HEIGHT, rgba.data()))
+          printf("Wrote %s\n", ppmPath);
+      }
+    }
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - runStart)
+                       .count();
+  for (double &ms : times)
+    ms /= loops;
+
+  if (perFrame) {
+    printf("%8s %10s\n", "frame", "ms");
+    for (int i = 0; i < frames; i++)
+      printf("%8d %10.3f\n", i, times[i]);
+  }
+  double total = 0, worst = 0;
+  for (double ms : times) {
+    total += ms;
+    worst = std::max(worst, ms);
+  }
+  printf("%8s %10s %10s %10s %10s\n", "frames", "avg ms", "median", "p95",
+         "worst ms");
+  printf("%8d %10.3f %10.3f %10.3f %10.3f\n", frames, total / frames,
+         Percentile(times, 0.5), Percentile(times, 0.95), worst);
+  printf("%d frames in %.2f s (%.1f fps) on the %s backend\n",
+         frames * loops, seconds, frames * loops / seconds,
+         Renderer()->Name());
+  StopJobSystem();
+  return 0;
+}
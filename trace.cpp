@@ -0,0 +1,526 @@
+#include "trace.h"
+
+#include "engine.h"
+#include "background.h"
+#include "palette_mesh.h"
+#include "render_backend.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+namespace {
+
+// ============================================================================
+// File format
+// ============================================================================
+
+// A header, then records of a one-byte opcode and its operands in native
+// byte order. Textures and meshes are numbered in the order they were
+// created, and the draws that use them refer to that number.
+const char kMagic[4] = {'S', 'T', 'R', 'C'};
+const uint32_t kVersion = 1;
+
+enum Opcode : uint8_t {
+  OP_BEGIN_FRAME,     // r, g, b
+  OP_END_FRAME,
+  OP_PUSH_PROJECTION, // left, right, bottom, top
+  OP_POP_PROJECTION,
+  OP_FILL_PRIMITIVE,  // u8 primitive, u32 count, r, g, b, a, count x, y pairs
+  OP_FILL_SHAPE,      // u8 shape, x, y, size, r, g, b, a
+  OP_CREATE_MESH,     // u32 count, count parts: u8 circle, 6 floats, u8 color
+  OP_DRAW_MESH,       // u32 mesh, x, y, u8 colors, colors RGBA entries
+  OP_CREATE_TEXTURE,  // u32 width, u32 height, RGBA pixels
+  OP_DRAW_TEXTURE,    // u32 texture, x, y, w, h
+  OP_DRAW_TEXT,       // u8 font, u16 length, text, x, y, r, g, b
+  OP_DRAW_SKY,        // SkyLayer
+};
+
+// The fonts the scenes use, by their number in the trace
+void *const *Fonts() {
+  static void *const fonts[] = {GLUT_BITMAP_HELVETICA_12,
+                                GLUT_BITMAP_HELVETICA_18,
+                                GLUT_BITMAP_TIMES_ROMAN_24};
+  return fonts;
+}
+const int kFontCount = 3;
+
+uint8_t FontIndex(void *font) {
+  for (int i = 0; i < kFontCount; i++)
+    if (Fonts()[i] == font)
+      return i;
+  return 1; // drawText's default
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+class TraceRecorder : public RenderBackend {
+public:
+  TraceRecorder(RenderBackend *inner, gzFile file)
+      : inner(inner), file(file) {}
+  ~TraceRecorder() {
+    Flush();
+    gzclose(file);
+  }
+
+  RenderBackend *Inner() const { return inner; }
+
+  // Writes what has been recorded since the last frame ended
+  void Flush() {
+    if (!out.empty())
+      gzwrite(file, out.data(), (unsigned)out.size());
+    out.clear();
+  }
+
+  int Frames() const { return frames; }
+
+  const char *Name() const override { return inner->Name(); }
+
+  void BeginFrame(float r, float g, float b) override {
+    Put(OP_BEGIN_FRAME);
+    Put(r), Put(g), Put(b);
+    inner->BeginFrame(r, g, b);
+  }
+
+  void EndFrame() override {
+    Put(OP_END_FRAME);
+    inner->EndFrame();
+    Flush();
+    frames++;
+  }
+
+  DrawStats LastDrawStats() const override { return inner->LastDrawStats(); }
+
+  void PushProjection(float left, float right, float bottom,
+                      float top) override {
+    Put(OP_PUSH_PROJECTION);
+    Put(left), Put(right), Put(bottom), Put(top);
+    inner->PushProjection(left, right, bottom, top);
+  }
+
+  void PopProjection() override {
+    Put(OP_POP_PROJECTION);
+    inner->PopProjection();
+  }
+
+  void FillPrimitive(Primitive primitive, const float *xy, int count, float r,
+                     float g, float b, float a) override {
+    Put(OP_FILL_PRIMITIVE);
+    Put((uint8_t)primitive);
+    Put((uint32_t)count);
+    Put(r), Put(g), Put(b), Put(a);
+    PutBytes(xy, sizeof(float) * 2 * count);
+    inner->FillPrimitive(primitive, xy, count, r, g, b, a);
+  }
+
+  // A shape the backend turns down comes back as the primitives the
+  // caller tessellates it into, so only accepted ones are recorded
+  bool FillShape(Shape shape, float x, float y, float size, float r, float g,
+                 float b, float a) override {
+    if (!inner->FillShape(shape, x, y, size, r, g, b, a))
+      return false;
+    Put(OP_FILL_SHAPE);
+    Put((uint8_t)shape);
+    Put(x), Put(y), Put(size);
+    Put(r), Put(g), Put(b), Put(a);
+    return true;
+  }
+
+  int CreateMesh(const MeshPart *parts, int count) override {
+    int handle = inner->CreateMesh(parts, count);
+    if (handle == 0)
+      return 0;
+    Put(OP_CREATE_MESH);
+    Put((uint32_t)count);
+    for (int i = 0; i < count; i++) {
+      Put((uint8_t)parts[i].circle);
+      PutBytes(parts[i].xy, sizeof(parts[i].xy));
+      Put((uint8_t)parts[i].color);
+    }
+    meshes[handle] = meshCount++;
+    return handle;
+  }
+
+  // Not recorded: replay numbers meshes by creation, and a handle the inner
+  // renderer gives out again is recorded as a new mesh
+  void DestroyMesh(int mesh) override {
+    inner->DestroyMesh(mesh);
+    meshes.erase(mesh);
+  }
+
+  bool DrawMesh(int mesh, float x, float y, const float *palette,
+                int colors) override {
+    if (!inner->DrawMesh(mesh, x, y, palette, colors))
+      return false;
+    // A mesh created before tracing started has no number to refer to
+    auto found = meshes.find(mesh);
+    if (found != meshes.end()) {
+      Put(OP_DRAW_MESH);
+      Put((uint32_t)found->second);
+      Put(x), Put(y);
+      Put((uint8_t)colors);
+      PutBytes(palette, sizeof(float) * 4 * colors);
+    }
+    return true;
+  }
+
+  GLuint CreateTexture(const Image &image) override {
+    GLuint texture = inner->CreateTexture(image);
+    Put(OP_CREATE_TEXTURE);
+    Put((uint32_t)image.width);
+    Put((uint32_t)image.height);
+    PutBytes(image.pixels.data(), image.pixels.size());
+    textures[texture] = textureCount++;
+    return texture;
+  }
+
+  void DrawTexture(GLuint texture, float x, float y, float w,
+                   float h) override {
+    auto found = textures.find(texture);
+    if (found != textures.end()) {
+      Put(OP_DRAW_TEXTURE);
+      Put((uint32_t)found->second);
+      Put(x), Put(y), Put(w), Put(h);
+    }
+    inner->DrawTexture(texture, x, y, w, h);
+  }
+
+  void DrawText(const char *text, int length, float x, float y, void *font,
+                float r, float g, float b) override {
+    Put(OP_DRAW_TEXT);
+    Put(FontIndex(font));
+    Put((uint16_t)length);
+    PutBytes(text, length);
+    Put(x), Put(y);
+    Put(r), Put(g), Put(b);
+    inner->DrawText(text, length, x, y, font, r, g, b);
+  }
+
+  bool DrawSky(const SkyLayer &sky) override {
+    if (!inner->DrawSky(sky))
+      return false;
+    Put(OP_DRAW_SKY);
+    Put(sky);
+    return true;
+  }
+
+  void ReadFrame(std::vector<unsigned char> &rgba) override {
+    inner->ReadFrame(rgba);
+  }
+  void QueueReadback() override { inner->QueueReadback(); }
+  bool TakeReadback(std::vector<unsigned char> &rgba, bool wait) override {
+    return inner->TakeReadback(rgba, wait);
+  }
+
+private:
+  void PutBytes(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    out.insert(out.end(), bytes, bytes + size);
+  }
+  template <typename T> void Put(const T &value) {
+    PutBytes(&value, sizeof(value));
+  }
+
+  RenderBackend *inner;
+  gzFile file;
+  std::vector<uint8_t> out; // the frame being recorded
+  int frames = 0;
+  // Inner backend handles to trace numbers
+  std::map<int, int> meshes;
+  std::map<GLuint, int> textures;
+  int meshCount = 0, textureCount = 0;
+};
+
+TraceRecorder *recorder = nullptr;
+std::string tracePath;
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+// Reads operands off a record. Once the data runs out every read fails
+// and returns zero, so a trace cut short by a crash still replays up to
+// its last whole frame.
+struct Cursor {
+  const uint8_t *at, *end;
+  bool ok = true;
+
+  const uint8_t *Take(size_t size) {
+    if (!ok || (size_t)(end - at) < size) {
+      ok = false;
+      return nullptr;
+    }
+    const uint8_t *bytes = at;
+    at += size;
+    return bytes;
+  }
+  template <typename T> T Get() {
+    T value = T();
+    if (const uint8_t *bytes = Take(sizeof(T)))
+      memcpy(&value, bytes, sizeof(T));
+    return value;
+  }
+};
+
+} // namespace
+
+bool StartTrace(const char *path) {
+  gzFile file = gzopen(path, "wb1"); // frames are large; favor speed
+  if (!file) {
+    printf("Failed to write trace: %s\n", path);
+    return false;
+  }
+  gzwrite(file, kMagic, sizeof(kMagic));
+  uint32_t header[] = {kVersion, (uint32_t)WINDOW_WIDTH,
+                       (uint32_t)WINDOW_HEIGHT};
+  gzwrite(file, header, sizeof(header));
+
+  recorder = new TraceRecorder(Renderer(), file);
+  tracePath = path;
+  SetRenderer(recorder);
+  return true;
+}
+
+void StopTrace() {
+  if (!recorder)
+    return;
+  SetRenderer(recorder->Inner());
+  printf("Traced %d frames to %s\n", recorder->Frames(), tracePath.c_str());
+  delete recorder;
+  recorder = nullptr;
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+// Created again on each renderer the first time a frame draws it
+struct TraceReplay::Texture {
+  Image image;
+  RenderBackend *backend = nullptr;
+  GLuint texture = 0;
+};
+
+struct TraceReplay::Mesh {
+  PaletteMesh mesh; // keeps its own handle per renderer
+};
+
+TraceReplay::~TraceReplay() {
+  for (Texture *texture : textures)
+    delete texture;
+  for (Mesh *mesh : meshes)
+    delete mesh;
+}
+
+bool TraceReplay::Open(const char *path) {
+  gzFile file = gzopen(path, "rb");
+  if (!file) {
+    printf("Failed to read trace: %s\n", path);
+    return false;
+  }
+  data.clear();
+  uint8_t chunk[1 << 16];
+  int read;
+  while ((read = gzread(file, chunk, sizeof(chunk))) > 0)
+    data.insert(data.end(), chunk, chunk + read);
+  gzclose(file);
+
+  Cursor cursor = {data.data(), data.data() + data.size()};
+  const uint8_t *magic = cursor.Take(sizeof(kMagic));
+  uint32_t version = cursor.Get<uint32_t>();
+  uint32_t width = cursor.Get<uint32_t>();
+  uint32_t height = cursor.Get<uint32_t>();
+  if (!magic || memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      version != kVersion) {
+    printf("Not a trace: %s\n", path);
+    return false;
+  }
+  if ((int)width != WINDOW_WIDTH || (int)height != WINDOW_HEIGHT)
+    printf("Trace was recorded at %ux%u; replaying at %dx%d\n", width, height,
+           WINDOW_WIDTH, WINDOW_HEIGHT);
+
+  // One pass to find the frames and load the textures and meshes, which
+  // can be created between frames as well as within them
+  frames.clear();
+  size_t offset = cursor.at - data.data();
+  size_t record = offset, frameStart = 0;
+  int opcode;
+  while ((opcode = Step(offset, false)) >= 0) {
+    if (opcode == OP_BEGIN_FRAME)
+      frameStart = record;
+    else if (opcode == OP_END_FRAME)
+      frames.push_back(frameStart);
+    record = offset;
+  }
+  if (frames.empty()) {
+    printf("No whole frames in trace: %s\n", path);
+    return false;
+  }
+  return true;
+}
+
+void TraceReplay::Replay(int frame) {
+  size_t offset = frames[frame];
+  int opcode;
+  do
+    opcode = Step(offset, true);
+  while (opcode >= 0 && opcode != OP_END_FRAME);
+}
+
+// Reads the record at offset and moves past it. With draw set its call is
+// issued; without, textures and meshes are loaded and draws skipped.
+// Returns the opcode, or -1 at the end of the data.
+int TraceReplay::Step(size_t &offset, bool draw) {
+  Cursor in = {data.data() + offset, data.data() + data.size()};
+  int opcode = in.Get<uint8_t>();
+  if (!in.ok)
+    return -1;
+  RenderBackend *renderer = Renderer();
+
+  switch (opcode) {
+  case OP_BEGIN_FRAME: {
+    float r = in.Get<float>(), g = in.Get<float>(), b = in.Get<float>();
+    if (in.ok && draw)
+      renderer->BeginFrame(r, g, b);
+    break;
+  }
+  case OP_END_FRAME:
+    if (draw)
+      renderer->EndFrame();
+    break;
+  case OP_PUSH_PROJECTION: {
+    float left = in.Get<float>(), right = in.Get<float>();
+    float bottom = in.Get<float>(), top = in.Get<float>();
+    if (in.ok && draw)
+      pushProjection(left, right, bottom, top);
+    break;
+  }
+  case OP_POP_PROJECTION:
+    if (draw)
+      popProjection();
+    break;
+  case OP_FILL_PRIMITIVE: {
+    Primitive primitive = (Primitive)in.Get<uint8_t>();
+    uint32_t count = in.Get<uint32_t>();
+    float r = in.Get<float>(), g = in.Get<float>();
+    float b = in.Get<float>(), a = in.Get<float>();
+    // Records are not aligned, so the vertices are copied out
+    const uint8_t *xy = in.Take(sizeof(float) * 2 * (size_t)count);
+    if (in.ok && draw) {
+      vertices.resize(count * 2);
+      memcpy(vertices.data(), xy, sizeof(float) * 2 * count);
+      renderer->FillPrimitive(primitive, vertices.data(), count, r, g, b, a);
+    }
+    break;
+  }
+  case OP_FILL_SHAPE: {
+    Shape shape = (Shape)in.Get<uint8_t>();
+    float x = in.Get<float>(), y = in.Get<float>(), size = in.Get<float>();
+    float r = in.Get<float>(), g = in.Get<float>();
+    float b = in.Get<float>(), a = in.Get<float>();
+    if (!in.ok || !draw)
+      break;
+    // Through the helpers, so a backend without shapes tessellates them
+    if (shape == SHAPE_CIRCLE)
+      drawCircle(x, y, size, r, g, b, a);
+    else if (shape == SHAPE_BOWL)
+      drawBowl(x, y, size, r, g, b);
+    else
+      drawHeart(x, y, size, r, g, b);
+    break;
+  }
+  case OP_CREATE_MESH: {
+    uint32_t count = in.Get<uint32_t>();
+    Mesh *mesh = draw ? nullptr : new Mesh;
+    for (uint32_t i = 0; i < count && in.ok; i++) {
+      bool circle = in.Get<uint8_t>() != 0;
+      float v[6];
+      for (float &value : v)
+        value = in.Get<float>();
+      // Backends index a kMaxPaletteColors palette by it
+      int color = std::min((int)in.Get<uint8_t>(), kMaxPaletteColors - 1);
+      if (!mesh)
+        continue;
+      if (circle)
+        mesh->mesh.AddCircle(v[0], v[1], v[2], color);
+      else
+        mesh->mesh.AddTriangle(v[0], v[1], v[2], v[3], v[4], v[5], color);
+    }
+    if (mesh)
+      meshes.push_back(mesh);
+    break;
+  }
+  case OP_DRAW_MESH: {
+    uint32_t mesh = in.Get<uint32_t>();
+    float x = in.Get<float>(), y = in.Get<float>();
+    int colors = in.Get<uint8_t>();
+    PaletteColor palette[kMaxPaletteColors] = {};
+    for (int i = 0; i < colors && in.ok; i++) {
+      PaletteColor color = in.Get<PaletteColor>();
+      if (i < kMaxPaletteColors)
+        palette[i] = color;
+    }
+    if (in.ok && draw && mesh < meshes.size())
+      meshes[mesh]->mesh.Draw(x, y, palette,
+                              std::min(colors, kMaxPaletteColors));
+    break;
+  }
+  case OP_CREATE_TEXTURE: {
+    uint32_t width = in.Get<uint32_t>(), height = in.Get<uint32_t>();
+    size_t size = (size_t)width * height * 4;
+    const uint8_t *pixels = in.Take(size);
+    if (in.ok && !draw) {
+      Texture *texture = new Texture;
+      texture->image.width = width;
+      texture->image.height = height;
+      texture->image.pixels.assign(pixels, pixels + size);
+      textures.push_back(texture);
+    }
+    break;
+  }
+  case OP_DRAW_TEXTURE: {
+    uint32_t index = in.Get<uint32_t>();
+    float x = in.Get<float>(), y = in.Get<float>();
+    float w = in.Get<float>(), h = in.Get<float>();
+    if (!in.ok || !draw || index >= textures.size())
+      break;
+    Texture *texture = textures[index];
+    if (texture->backend != renderer) {
+      texture->backend = renderer;
+      texture->texture = renderer->CreateTexture(texture->image);
+    }
+    renderer->DrawTexture(texture->texture, x, y, w, h);
+    break;
+  }
+  case OP_DRAW_TEXT: {
+    int font = in.Get<uint8_t>();
+    int length = in.Get<uint16_t>();
+    const char *text = (const char *)in.Take(length);
+    float x = in.Get<float>(), y = in.Get<float>();
+    float r = in.Get<float>(), g = in.Get<float>(), b = in.Get<float>();
+    if (in.ok && draw)
+      renderer->DrawText(text, length, x, y,
+                         Fonts()[font < kFontCount ? font : 1], r, g, b);
+    break;
+  }
+  case OP_DRAW_SKY: {
+    SkyLayer sky = in.Get<SkyLayer>();
+    if (in.ok && draw)
+      drawSkyLayer(sky);
+    break;
+  }
+  default:
+    return -1; // not something this version writes
+  }
+
+  if (!in.ok)
+    return -1;
+  offset = in.at - data.data();
+  return opcode;
+}
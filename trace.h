@@ -0,0 +1,52 @@
+// Recording of the render command stream, for benchmarking backends on a
+// real session without playing it. While a trace is running every call the
+// drawing helpers make on the renderer is passed through and also written,
+// gzip-compressed, to a file: primitives with their vertices and colors,
+// shapes, palette meshes, textures (pixels included, once), text and sky
+// layers. A replay feeds the calls back through any backend, so the same
+// frames can be timed on each.
+//
+// Calls are recorded as the recording backend accepted them: a shape or sky
+// it drew analytically is one call, and a backend without them records the
+// triangles the helpers fell back to. Replaying an analytic call on a
+// backend without it falls back the same way.
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Wraps the current renderer so everything drawn from here on is also
+// written to path. Call after SetRenderer.
+bool StartTrace(const char *path);
+// Finishes the file and puts the wrapped renderer back
+void StopTrace();
+
+class TraceReplay {
+public:
+  ~TraceReplay();
+
+  // Reads the whole trace into memory. Prints the reason and returns false
+  // if it cannot be read or is not a trace.
+  bool Open(const char *path);
+  int Frames() const { return (int)frames.size(); }
+
+  // Issues frame's calls, BeginFrame to EndFrame, on the current renderer.
+  // Textures and meshes are created on first use by each renderer.
+  void Replay(int frame);
+
+private:
+  struct Texture;
+  struct Mesh;
+
+  int Step(size_t &offset, bool draw);
+
+  std::vector<uint8_t> data;
+  std::vector<size_t> frames; // offset of each BeginFrame
+  std::vector<Texture *> textures;
+  std::vector<Mesh *> meshes;
+  std::vector<float> vertices; // aligned copy of a primitive's
+};
+
+#endif
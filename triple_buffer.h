@@ -0,0 +1,39 @@
+// Wait-free hand-off of whole frames from one writer thread to one reader.
+// The writer fills WriteBuffer() and calls Publish(); the reader calls
+// Update() and then Read() to get the newest published frame. Neither side
+// ever blocks, and the reader never sees a frame that is half written.
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+template <typename T> class TripleBuffer {
+public:
+  // Writer side
+  T &WriteBuffer() { return buffers[writeIndex]; }
+  void Publish() {
+    int old = middle.exchange(writeIndex | kFresh, std::memory_order_acq_rel);
+    writeIndex = old & kIndexMask;
+  }
+
+  // Reader side. Returns true if a newer frame was swapped in.
+  bool Update() {
+    if (!(middle.load(std::memory_order_relaxed) & kFresh))
+      return false;
+    int old = middle.exchange(readIndex, std::memory_order_acq_rel);
+    readIndex = old & kIndexMask;
+    return true;
+  }
+  const T &Read() const { return buffers[readIndex]; }
+
+private:
+  static const int kIndexMask = 3;
+  static const int kFresh = 4; // middle holds a frame the reader has not seen
+
+  T buffers[3];
+  int writeIndex = 0;
+  int readIndex = 1;
+  std::atomic<int> middle{2};
+};
+
+#endif
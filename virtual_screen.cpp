@@ -0,0 +1,156 @@
+#define GL_GLEXT_PROTOTYPES
+#include "virtual_screen.h"
+
+#include "gl_shaders.h"
+
+#include <GL/glext.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+// Frames averaged before the controller may move the scale again
+const int kSettleFrames = 20;
+// Internal sizes are multiples of 1/32 of the view, so small swings in
+// frame time don't reallocate the target every few frames
+const float kScaleStep = 1.0f / 32;
+// Grow back only when well under budget: a step up costs about 20% more
+const float kGrowBelow = 0.7f;
+const float kGrowBy = 1.1f;
+
+} // namespace
+
+// ===== VirtualScreen =====
+void VirtualScreen::Resize(int width, int height) {
+  windowWidth = std::max(width, 1);
+  windowHeight = std::max(height, 1);
+  if (windowWidth * WINDOW_HEIGHT > windowHeight * WINDOW_WIDTH) {
+    // Wider than the screen: bars left and right
+    view.height = windowHeight;
+    view.width = windowHeight * WINDOW_WIDTH / WINDOW_HEIGHT;
+  } else {
+    view.width = windowWidth;
+    view.height = windowWidth * WINDOW_HEIGHT / WINDOW_WIDTH;
+  }
+  view.x = (windowWidth - view.width) / 2;
+  view.y = (windowHeight - view.height) / 2;
+}
+
+void VirtualScreen::ToVirtual(int &x, int &y) const {
+  int top = windowHeight - view.y - view.height;
+  x = (int)std::floor((x - view.x) * (float)WINDOW_WIDTH / view.width);
+  y = (int)std::floor((y - top) * (float)WINDOW_HEIGHT / view.height);
+}
+
+// ===== ResolutionController =====
+ResolutionController::ResolutionController(float budgetMs, float minScale)
+    : budget(budgetMs), minScale(minScale) {}
+
+float ResolutionController::Update(double frameMs) {
+  average = frames == 0 ? frameMs : average * 0.9 + frameMs * 0.1;
+  if (++frames < kSettleFrames)
+    return scale;
+
+  // Frame time follows the pixel count, which goes with the square
+  float next = scale;
+  if (average > budget)
+    next = std::floor(scale * std::sqrt(budget / average) / kScaleStep) *
+           kScaleStep;
+  else if (average < budget * kGrowBelow)
+    next = std::ceil(scale * kGrowBy / kScaleStep) * kScaleStep;
+  next = std::min(std::max(next, minScale), 1.0f);
+  if (next != scale) {
+    scale = next;
+    frames = 0; // times measured at the old size no longer apply
+  }
+  return scale;
+}
+
+// ===== ScaledTarget =====
+ScaledTarget::~ScaledTarget() {
+  if (framebuffer) {
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteRenderbuffers(1, &color);
+  }
+  if (timers)
+    glDeleteQueries(kQueries, queries);
+}
+
+bool ScaledTarget::Init() {
+  tried = true;
+  int version = GLVersion();
+  supported = version >= 30;
+  timers = version >= 33;
+  if (!supported) {
+    printf("Scaled rendering needs GL 3.0; drawing at window size\n");
+    return false;
+  }
+  glGenFramebuffers(1, &framebuffer);
+  glGenRenderbuffers(1, &color);
+  if (timers)
+    glGenQueries(kQueries, queries);
+  return true;
+}
+
+bool ScaledTarget::Begin(int targetWidth, int targetHeight) {
+  if (!tried)
+    Init();
+  if (!supported)
+    return false;
+
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  bool resized = targetWidth != width || targetHeight != height;
+  if (resized) {
+    width = targetWidth;
+    height = targetHeight;
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, color);
+  }
+  glViewport(0, 0, width, height);
+
+  // A frame that reallocates the target times the allocation more than
+  // the drawing, and a full ring means nobody is taking the times
+  timing = timers && !resized && queryCount < kQueries;
+  if (timing)
+    glBeginQuery(GL_TIME_ELAPSED,
+                 queries[(queryFirst + queryCount) % kQueries]);
+  return true;
+}
+
+void ScaledTarget::Present(const ScreenRect &view, int windowWidth,
+                           int windowHeight) {
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+  glViewport(0, 0, windowWidth, windowHeight);
+  glClearColor(0, 0, 0, 1);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glBlitFramebuffer(0, 0, width, height, view.x, view.y, view.x + view.width,
+                    view.y + view.height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+  if (timing) {
+    glEndQuery(GL_TIME_ELAPSED);
+    queryCount++;
+  }
+}
+
+bool ScaledTarget::TakeFrameTime(double &ms) {
+  if (queryCount == 0)
+    return false;
+  GLuint query = queries[queryFirst];
+  GLint ready = 0;
+  glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &ready);
+  if (!ready)
+    return false;
+  GLuint64 nanoseconds = 0;
+  glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+  queryFirst = (queryFirst + 1) % kQueries;
+  queryCount--;
+  ms = nanoseconds / 1e6;
+  return true;
+}
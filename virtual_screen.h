@@ -0,0 +1,87 @@
+// The game is laid out on a fixed WINDOW_WIDTH x WINDOW_HEIGHT virtual
+// screen. A window of any size or pixel density shows it letterboxed at the
+// largest size that keeps its aspect. With GL the screen can also be drawn
+// at a lower internal resolution into an offscreen target that is filtered
+// up to the window, and a controller picks that resolution from measured
+// frame times so slow (software) GL holds its frame budget.
+#ifndef VIRTUAL_SCREEN_H
+#define VIRTUAL_SCREEN_H
+
+#include "engine.h"
+
+// Window pixels, origin bottom left like glViewport
+struct ScreenRect {
+  int x, y, width, height;
+};
+
+class VirtualScreen {
+public:
+  // Call from the reshape callback with the window's size in pixels
+  void Resize(int windowWidth, int windowHeight);
+
+  int WindowWidth() const { return windowWidth; }
+  int WindowHeight() const { return windowHeight; }
+  // Where the virtual screen lands in the window
+  const ScreenRect &View() const { return view; }
+  // Window pixels per virtual unit
+  float Scale() const { return view.width / (float)WINDOW_WIDTH; }
+
+  // GLUT event coordinates (window pixels, origin top left) to virtual
+  // coordinates with the same origin, so scenes flip y as before
+  void ToVirtual(int &x, int &y) const;
+
+private:
+  int windowWidth = WINDOW_WIDTH, windowHeight = WINDOW_HEIGHT;
+  ScreenRect view = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
+};
+
+// Picks the fraction of the view's resolution to render at. Frame times
+// are smoothed, and the scale only moves after a run of frames is clearly
+// over or under budget, so it settles instead of flickering between sizes.
+class ResolutionController {
+public:
+  ResolutionController(float budgetMs, float minScale = 0.5f);
+
+  // The time the GPU took for one frame; returns the scale to render at
+  float Update(double frameMs);
+  float Scale() const { return scale; }
+
+private:
+  float budget, minScale;
+  float scale = 1;
+  double average = 0;
+  int frames = 0;
+};
+
+// Offscreen color target that frames are drawn into below window resolution
+// and then filtered up to it. Needs framebuffer objects (GL 3.0); elsewhere
+// Begin returns false and the frame is drawn straight to the window.
+class ScaledTarget {
+public:
+  ~ScaledTarget();
+
+  // Binds a width x height target, sets the viewport to it and starts
+  // timing the frame
+  bool Begin(int width, int height);
+  // Stops timing, then draws the target over view on the window with
+  // bilinear filtering and black bars around it. Leaves the window bound.
+  void Present(const ScreenRect &view, int windowWidth, int windowHeight);
+
+  // The oldest frame time the GPU has finished measuring, in milliseconds.
+  // Returns false if none is ready yet or timer queries are missing.
+  bool TakeFrameTime(double &ms);
+  // Whether the GL has timer queries (GL 3.3), once Begin has run
+  bool Timed() const { return timers; }
+
+private:
+  bool Init();
+
+  static const int kQueries = 4; // frames a time may lag behind
+  bool tried = false, supported = false, timers = false, timing = false;
+  GLuint framebuffer = 0, color = 0;
+  int width = 0, height = 0;
+  GLuint queries[kQueries] = {};
+  int queryFirst = 0, queryCount = 0;
+};
+
+#endif